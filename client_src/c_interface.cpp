@@ -58,6 +58,78 @@ extern "C" bool vrpn_c_close_tracker(void *device)
 };
 
 
+/* A tracker read with vrpn_c_poll_tracker_samples(): the remote, and the
+ * caller's arrays while a poll is running. */
+typedef struct {
+	vrpn_Tracker_Remote	*tkr;
+	vrpn_c_tracker_samples	*samples;
+} vrpn_c_tracker_sampler;
+
+/* Helper function that receives the callback handler from the C++ Tracker
+ * remote and appends the report to the arrays of the poll in progress. */
+void	VRPN_CALLBACK handle_tracker_sample (void *userdata, const vrpn_TRACKERCB t)
+{
+	vrpn_c_tracker_samples *s = ((vrpn_c_tracker_sampler *)(userdata))->samples;
+	if (s == NULL) { return; }
+	if (s->count >= s->capacity) {
+		s->dropped++;
+		return;
+	}
+
+	unsigned i = s->count++;
+	s->time[i] = t.msg_time.tv_sec + t.msg_time.tv_usec * 1e-6;
+	s->sensor[i] = t.sensor;
+	s->pos[0][i] = t.pos[0];
+	s->pos[1][i] = t.pos[1];
+	s->pos[2][i] = t.pos[2];
+	s->quat[0][i] = t.quat[0];
+	s->quat[1][i] = t.quat[1];
+	s->quat[2][i] = t.quat[2];
+	s->quat[3][i] = t.quat[3];
+};
+
+/* Open a tracker device to be read with vrpn_c_poll_tracker_samples() rather
+ * than through a callback.  Returns NULL on failure, an opaque pointer to the
+ * tracker device on success. */
+extern "C" void *vrpn_c_open_tracker_samples(const char *device_name)
+{
+	vrpn_c_tracker_sampler *sampler = new vrpn_c_tracker_sampler;
+	sampler->tkr = new vrpn_Tracker_Remote(device_name);
+	sampler->samples = NULL;
+	sampler->tkr->register_change_handler(sampler, handle_tracker_sample);
+	return sampler;
+};
+
+/* Poll the tracker whose device pointer is passed in, storing every position
+ * report that comes in into the samples arrays.  Returns false if the device
+ * is not working. */
+extern "C" bool vrpn_c_poll_tracker_samples(void *device, vrpn_c_tracker_samples *samples)
+{
+	if ( (device == NULL) || (samples == NULL) ) { return false; }
+	vrpn_c_tracker_sampler *sampler = (vrpn_c_tracker_sampler *)device;
+
+	samples->count = 0;
+	samples->dropped = 0;
+	sampler->samples = samples;
+	sampler->tkr->mainloop();
+	sampler->samples = NULL;
+	return true;
+};
+
+/* Close a tracker opened with vrpn_c_open_tracker_samples().  Returns true on
+ * success, false on failure. */
+extern "C" bool vrpn_c_close_tracker_samples(void *device)
+{
+	if (device == NULL) { return false; }
+	vrpn_c_tracker_sampler *sampler = (vrpn_c_tracker_sampler *)device;
+
+	sampler->tkr->unregister_change_handler(sampler, handle_tracker_sample);
+	delete sampler->tkr;
+	delete sampler;
+	return true;
+};
+
+
 /* Helper function that receives the callback handler from the C++ Button
  * remote, repackages the values, and calls the user callback function. */
 void	VRPN_CALLBACK handle_button_event (void *userdata, const vrpn_BUTTONCB b)
@@ -26,6 +26,37 @@ extern "C" bool vrpn_c_poll_tracker(void *device);
 extern "C" bool vrpn_c_close_tracker(void *device);
 
 
+/* Reports drained from a tracker by vrpn_c_poll_tracker_samples(), kept as a
+ * structure of arrays: entry i of each array belongs to the i'th report.  The
+ * caller provides the arrays, each with room for capacity entries, and sets
+ * capacity; the poll fills in count and dropped. */
+typedef struct {
+	unsigned	capacity;	/* Entries each array has room for */
+	unsigned	count;		/* Reports stored by the last poll */
+	unsigned	dropped;	/* Reports that came in with the arrays full */
+	double		*time;		/* Message time, in seconds */
+	int		*sensor;
+	double		*pos[3];	/* x, y and z */
+	double		*quat[4];
+} vrpn_c_tracker_samples;
+
+/* Open a tracker device to be read with vrpn_c_poll_tracker_samples() rather
+ * than through a callback.  Returns NULL on failure, an opaque pointer to the
+ * tracker device on success. */
+extern "C" void *vrpn_c_open_tracker_samples(const char *device_name);
+
+/* Poll the tracker whose device pointer is passed in, storing every position
+ * report that comes in into the samples arrays.  This makes one call for all
+ * of the reports, rather than one callback per report, which is what matters
+ * when the caller is on the far side of a language binding.  Returns false if
+ * the device is not working. */
+extern "C" bool vrpn_c_poll_tracker_samples(void *device, vrpn_c_tracker_samples *samples);
+
+/* Close a tracker opened with vrpn_c_open_tracker_samples().  Returns true on
+ * success, false on failure. */
+extern "C" bool vrpn_c_close_tracker_samples(void *device);
+
+
 /* Function prototype for the function that will be called whenever a button
  * report comes in. */
 extern "C" typedef void (*vrpn_c_button_callback_function)(const unsigned button, const bool value);
@@ -0,0 +1,177 @@
+/* Benchmark for the tracker part of the C interface.  It runs a tracker
+ * server in the same program, has it send bursts of reports, and times the
+ * client polls that take them in: once through vrpn_c_poll_tracker() with a
+ * callback per report, and once through vrpn_c_poll_tracker_samples() with
+ * one call per poll.  Only the time spent in the polls is counted, so the
+ * result is samples per second of client time.  Reports go reliably, so none
+ * are lost between the two.
+ *
+ * Run with -serve it only runs the server, sending a burst every millisecond,
+ * so that the Python and Java bindings can be measured against it (see
+ * python/bench_tracker_drain.py and java_vrpn/test/TrackerSamplesTest.java).
+ * The bursts are paced because a client that cannot keep up would never get
+ * out of its mainloop.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <vrpn_Connection.h>
+#include <vrpn_Tracker.h>
+
+#include "c_interface.h"
+
+const int	DEFAULT_PORT = 4701;
+const int	NUM_SENSORS = 16;
+const int	BURST = 256;		/* Reports sent between polls */
+const int	CAPACITY = 4096;	/* Entries in the sample arrays */
+
+static vrpn_Connection		*connection;
+static vrpn_Tracker_Server	*server;
+static int			next_sensor = 0;
+
+static void send_burst(void)
+{
+	struct timeval	now;
+	vrpn_float64	pos[3], quat[4] = { 0, 0, 0, 1 };
+
+	vrpn_gettimeofday(&now, NULL);
+	for (int i = 0; i < BURST; i++) {
+		pos[0] = i; pos[1] = -i; pos[2] = next_sensor;
+		server->report_pose(next_sensor, now, pos, quat, vrpn_CONNECTION_RELIABLE);
+		next_sensor = (next_sensor + 1) % NUM_SENSORS;
+	}
+	server->mainloop();
+	connection->mainloop();
+}
+
+/* Arrays for both methods, so that they do the same work per report */
+static double	s_time[CAPACITY];
+static int	s_sensor[CAPACITY];
+static double	s_pos[3][CAPACITY];
+static double	s_quat[4][CAPACITY];
+static unsigned	s_count;
+
+void	tracker_callback(unsigned sensor, const double pos[3], const double quat[4])
+{
+	if (s_count >= (unsigned)CAPACITY) { s_count = 0; }
+	unsigned i = s_count++;
+	s_time[i] = 0;
+	s_sensor[i] = sensor;
+	s_pos[0][i] = pos[0]; s_pos[1][i] = pos[1]; s_pos[2][i] = pos[2];
+	s_quat[0][i] = quat[0]; s_quat[1][i] = quat[1];
+	s_quat[2][i] = quat[2]; s_quat[3][i] = quat[3];
+}
+
+/* Sends reports until total have been taken in by poll(), returning the
+ * samples per second of time spent in poll(). */
+static double time_polls(void *tkr, bool samples, long total)
+{
+	vrpn_c_tracker_samples	s;
+	struct timeval		start, end;
+	double			secs = 0;
+	long			received = 0;
+	long			sent = 0;
+
+	s.capacity = CAPACITY;
+	s.time = s_time;
+	s.sensor = s_sensor;
+	for (int j = 0; j < 3; j++) { s.pos[j] = s_pos[j]; }
+	for (int j = 0; j < 4; j++) { s.quat[j] = s_quat[j]; }
+
+	while (received < total) {
+		if (sent < total) {
+			send_burst();
+			sent += BURST;
+		} else {
+			connection->mainloop();
+		}
+		vrpn_gettimeofday(&start, NULL);
+		if (samples) {
+			vrpn_c_poll_tracker_samples(tkr, &s);
+			received += s.count + s.dropped;
+		} else {
+			s_count = 0;
+			vrpn_c_poll_tracker(tkr);
+			received += s_count;
+		}
+		vrpn_gettimeofday(&end, NULL);
+		secs += vrpn_TimevalMsecs(vrpn_TimevalDiff(end, start)) / 1000;
+	}
+	return received / secs;
+}
+
+/* Polls until the tracker has connected and the first reports come through. */
+static void connect(void *tkr, bool samples)
+{
+	vrpn_c_tracker_samples	s;
+
+	memset(&s, 0, sizeof(s));
+	for (int i = 0; (i < 1000) && !connection->connected(); i++) {
+		connection->mainloop();
+		if (samples) {
+			vrpn_c_poll_tracker_samples(tkr, &s);
+		} else {
+			vrpn_c_poll_tracker(tkr);
+		}
+		vrpn_SleepMsecs(1);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	int	port = DEFAULT_PORT;
+	bool	serve = false;
+	char	name[256];
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-serve")) {
+			serve = true;
+		} else {
+			port = atoi(argv[i]);
+		}
+	}
+	if (port <= 0) {
+		fprintf(stderr, "Usage: %s [-serve] [port]\n", argv[0]);
+		return -1;
+	}
+
+	connection = vrpn_create_server_connection(port);
+	server = new vrpn_Tracker_Server("Tracker0", connection, NUM_SENSORS);
+	if (serve) {
+		printf("Serving Tracker0@localhost:%d\n", port);
+		while (true) {
+			if (connection->connected()) {
+				send_burst();
+			} else {
+				connection->mainloop();
+			}
+			vrpn_SleepMsecs(1);
+		}
+	}
+
+	sprintf(name, "Tracker0@localhost:%d", port);
+	const long total = 200000;
+
+	// Hold on to the client connection, so that it stays up from one
+	// tracker to the next.
+	vrpn_Connection *client = vrpn_get_connection_by_name(name);
+
+	void *tkr = vrpn_c_open_tracker(name, tracker_callback);
+	connect(tkr, false);
+	double callback_rate = time_polls(tkr, false, total);
+	vrpn_c_close_tracker(tkr);
+
+	tkr = vrpn_c_open_tracker_samples(name);
+	double samples_rate = time_polls(tkr, true, total);
+	vrpn_c_close_tracker_samples(tkr);
+
+	printf("Samples/sec of poll time, %d reports per poll:\n", BURST);
+	printf("  vrpn_c_poll_tracker():          %10.0f\n", callback_rate);
+	printf("  vrpn_c_poll_tracker_samples():  %10.0f\n", samples_rate);
+
+	client->removeReference();
+	delete server;
+	connection->removeReference();
+	return 0;
+}
@@ -113,6 +113,26 @@ const int MAX_SENTENCE_SIZE = 1024;
 // No GPS I'm aware of can track more than 12 satellites.
 const uint8_ MAX_SATS = 12;
 
+// Maximum number of fields in a sentence, counting the '$xxTTT' field.
+const int MAX_SENTENCE_FIELDS = 64;
+
+// A sentence split into its fields by NMEAParser::splitSentence().  The
+// fields are copied into buffer with their commas replaced by NULs, so each
+// one can be handed to atof() and friends as it is.
+struct NMEAFields
+{
+  // Returns field i, or an empty string if the sentence has no such field.
+  const char* get (uint_ i) const
+  {
+    return i < count ? field[i] : "";
+  }
+
+  char buffer[MAX_SENTENCE_SIZE];
+  const char* field[MAX_SENTENCE_FIELDS];
+  uint_ count;        // Number of fields; field[0] is the '$xxTTT' field.
+  const char* type;   // Sentence type, the field[0] past the 'xx' talker.
+};
+
 // Data class stored with the parser.  To extract the data parsed from the
 // parser, pass an object of this class to the parser.
 // NOTE! NMEA sentences are not "Year 2000-compliant"{tm}
@@ -196,6 +216,14 @@ class NMEAParser
   virtual ~NMEAParser ();
   SENTENCE_STATUS parseSentence (const char* sentence);
 
+  // Splits a sentence into its fields and checks its checksum, both in a
+  // single pass over the characters.  The sentence must start with '$'; it
+  // ends at a line end or a NUL.  If next is not NULL it is set to the
+  // start of the line after the sentence.
+  static SENTENCE_STATUS splitSentence (const char* sentence,
+                                        NMEAFields& fields,
+                                        const char** next = 0);
+
   void setStartSentence(char *sentence)
   {
 	  strcpy(startSentence, sentence);
@@ -251,6 +279,7 @@ protected:
 
   virtual bool isKnownSentenceType (const char* sentence) const;
   virtual SENTENCE_STATUS parseValidSentence (const char* sentence);
+  virtual SENTENCE_STATUS parseFields (const NMEAFields& fields);
 
   NMEAData* m_data;
 
@@ -265,19 +294,21 @@ protected:
   int m_satArrayPos;       // Array position of the next sat entry.		
   SatData m_tempSatData[MAX_SATS];
 
+  // Fields of the sentence being parsed.
+  NMEAFields m_fields;
 
   // The logging category
   // sj: log4cpp::Category& logger;
 
 private:
-  void parseZDA(const char* sentence);
-  void parseGGA (const char* sentence);
-  void parseGLL (const char* sentence);
-  void parseRMC (const char* sentence);
-  void parseGSV (const char* sentence);
-  void parseGST (const char* sentence);
-  void parseVTG (const char* sentence);
-  void parseRRE (const char* sentence);
+  void parseZDA (const NMEAFields& fields);
+  void parseGGA (const NMEAFields& fields);
+  void parseGLL (const NMEAFields& fields);
+  void parseRMC (const NMEAFields& fields);
+  void parseGSV (const NMEAFields& fields);
+  void parseGST (const NMEAFields& fields);
+  void parseVTG (const NMEAFields& fields);
+  void parseRRE (const NMEAFields& fields);
 };
 
 #endif
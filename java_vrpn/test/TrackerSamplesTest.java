@@ -0,0 +1,96 @@
+import java.lang.management.*;
+import java.nio.ByteBuffer;
+import vrpn.*;
+
+/**
+ * Compares the two ways of reading a tracker from Java:  a
+ * PositionChangeListener called for each report, and a SamplesListener
+ * called once per mainloop with the reports stored into a direct buffer.
+ * The figure is samples per second of CPU time of the thread that runs
+ * the tracker's mainloop.
+ *
+ * Start the server from client_src first, which sends a burst of reports
+ * every millisecond:
+ *		c_interface_bench -serve 4701
+ * then run
+ *		java TrackerSamplesTest [Tracker0@localhost:4701]
+ */
+public class TrackerSamplesTest
+	implements vrpn.TrackerRemote.PositionChangeListener,
+	vrpn.TrackerRemote.SamplesListener
+{
+	static final int SECONDS = 3;
+	static final int CAPACITY = 4096;
+
+	ThreadMXBean threads = ManagementFactory.getThreadMXBean( );
+	long samples = 0;
+	long firstCpuTime = -1;
+	long lastCpuTime = -1;
+	double checksum = 0;
+
+	synchronized void tally( int n )
+	{
+		long now = threads.getCurrentThreadCpuTime( );
+		if( firstCpuTime < 0 )
+		{
+			firstCpuTime = now;
+		}
+		else
+		{
+			samples += n;
+		}
+		lastCpuTime = now;
+	}
+
+	synchronized double rate( )
+	{
+		double r = samples / ((lastCpuTime - firstCpuTime) * 1e-9);
+		samples = 0;
+		firstCpuTime = lastCpuTime = -1;
+		return r;
+	}
+
+	public void trackerPositionUpdate( TrackerRemote.TrackerUpdate u,
+									   TrackerRemote tracker )
+	{
+		checksum += u.pos[0];
+		tally( 1 );
+	}
+
+	public void trackerSamples( ByteBuffer s, int count, int dropped, TrackerRemote tracker )
+	{
+		// row 2 is x
+		for( int i = 0; i < count; i++ )
+			checksum += s.getDouble( 8 * (2 * CAPACITY + i) );
+		tally( count + dropped );
+	}
+
+	public static void main( String[] args ) throws Exception
+	{
+		String trackerName = args.length > 0 ? args[0] : "Tracker0@localhost:4701";
+		TrackerRemote tracker = new TrackerRemote( trackerName, null, null, null, null );
+		tracker.setTimerPeriod( 1 );
+		TrackerSamplesTest test = new TrackerSamplesTest( );
+
+		// let the connection come up before timing
+		Thread.sleep( 1000 );
+
+		tracker.addPositionChangeListener( test );
+		test.rate( );
+		Thread.sleep( SECONDS * 1000 );
+		double listenerRate = test.rate( );
+		tracker.removePositionChangeListener( test );
+
+		tracker.addSamplesListener( test );
+		tracker.setSampleBuffer( TrackerRemote.allocateSampleBuffer( CAPACITY ) );
+		test.rate( );
+		Thread.sleep( SECONDS * 1000 );
+		double samplesRate = test.rate( );
+		tracker.setSampleBuffer( null );
+
+		System.out.println( "Samples/sec of mainloop thread CPU time:" );
+		System.out.println( "  PositionChangeListener:  " + (long) listenerRate );
+		System.out.println( "  SamplesListener:         " + (long) samplesRate );
+		System.exit( 0 );
+	}
+}
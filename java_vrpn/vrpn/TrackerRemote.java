@@ -1,6 +1,8 @@
 
 package vrpn;
 import java.util.*;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 
 public class TrackerRemote extends VRPNDevice implements Runnable
@@ -51,6 +53,30 @@ public class TrackerRemote extends VRPNDevice implements Runnable
 		public void trackerAccelerationUpdate( AccelerationUpdate a, TrackerRemote tracker );
 	}
 	
+	
+	/**
+	 * Number of rows in a sample buffer.  Row <code>r</code> of sample 
+	 * <code>i</code> is the double at index <code>r * capacity + i</code>,
+	 * where <code>capacity</code> is the number of samples the buffer holds.
+	 * The rows are the message time in seconds, the sensor, x, y and z, and
+	 * the four components of the quaternion.
+	 */
+	public final static int SAMPLE_ROWS = 9;
+	
+	public interface SamplesListener
+	{
+		/**
+		 * Called once per mainloop with the position reports it brought in,
+		 * when a sample buffer is set.  The samples are only good until the 
+		 * method returns; the buffer is filled again by the next mainloop.
+		 * @param samples the buffer given to setSampleBuffer
+		 * @param count the number of samples stored in it
+		 * @param dropped the number of reports that came in with the buffer full
+		 */
+		public void trackerSamples( ByteBuffer samples, int count, int dropped, 
+									TrackerRemote tracker );
+	}
+	
 	// end of the public structures and interfaces
 	//////////////////////////////////
 	
@@ -102,6 +128,54 @@ public class TrackerRemote extends VRPNDevice implements Runnable
 	}
 	
 	
+	/**
+	 * Makes a buffer that can be given to setSampleBuffer.
+	 * @param capacity the number of samples it is to hold
+	 */
+	public static ByteBuffer allocateSampleBuffer( int capacity )
+	{
+		return ByteBuffer.allocateDirect( SAMPLE_ROWS * 8 * capacity ).order( ByteOrder.nativeOrder( ) );
+	}
+	
+	
+	/**
+	 * Has position reports stored straight into <code>samples</code> by the 
+	 * native code, and handed to the SamplesListeners once per mainloop,
+	 * instead of going to the PositionChangeListeners one call at a time.
+	 * For high-rate trackers, this takes most of the cost of crossing 
+	 * into Java out of each report.
+	 * @param samples a direct buffer in native byte order, such as made by 
+	 * allocateSampleBuffer, or <code>null</code> to go back to the 
+	 * PositionChangeListeners.
+	 * @return true on success; false on failure
+	 */
+	public synchronized boolean setSampleBuffer( ByteBuffer samples )
+	{
+		boolean retval = false;
+		synchronized( downInVrpnLock )
+		{
+			retval = setSampleBuffer_native( samples );
+			if( retval ) sampleBuffer = samples;
+		}
+		return retval;
+	}
+	
+	
+	public synchronized void addSamplesListener( SamplesListener listener )
+	{
+		samplesListeners.addElement( listener );
+	}
+	
+	
+	/**
+	 * @return true on success; false on failure
+	 */
+	public synchronized boolean removeSamplesListener( SamplesListener listener )
+	{
+		return samplesListeners.removeElement( listener );
+	}
+	
+	
 	public synchronized void addVelocityChangeListener( VelocityChangeListener listener )
 	{
 		velocityListeners.addElement( listener );
@@ -145,6 +219,7 @@ public class TrackerRemote extends VRPNDevice implements Runnable
 		changeListeners.removeAllElements( );
 		velocityListeners.removeAllElements( );
 		accelerationListeners.removeAllElements( );
+		samplesListeners.removeAllElements( );
 		synchronized( downInVrpnLock )
 		{
 			this.shutdownTracker( );
@@ -241,6 +316,26 @@ public class TrackerRemote extends VRPNDevice implements Runnable
 	} // end method handleAccelerationChange
 
 	
+	/**
+	 * @see #handleTrackerChange
+	 */
+	protected void handleTrackerSamples( int count, int dropped )
+	{
+		synchronized( notifyingSamplesListenersLock )
+		{
+			// notify all listeners
+			Enumeration e = samplesListeners.elements( );
+			while( e.hasMoreElements( ) )
+			{
+				SamplesListener l = (SamplesListener) e.nextElement( );
+				l.trackerSamples( sampleBuffer, count, dropped, this );
+			}
+		} // end synchronized( notifyingSamplesListenersLock )
+	} // end method handleTrackerSamples
+
+	
+	protected native boolean setSampleBuffer_native( ByteBuffer samples );
+	
 	protected native void shutdownTracker( );
 	
 	/**
@@ -268,6 +363,14 @@ public class TrackerRemote extends VRPNDevice implements Runnable
 	protected Vector changeListeners = new Vector( );
 	protected Vector velocityListeners = new Vector( );
 	protected Vector accelerationListeners = new Vector( );
+	protected Vector samplesListeners = new Vector( );
+	
+	protected ByteBuffer sampleBuffer = null;
+	
+	/**
+	 * The native code's state for this tracker; see vrpn_TrackerRemote.cpp.
+	 */
+	protected long native_state = -1;
 
 	/**
 	 * these notifying*ListenersLock variables are used to ensure that multiple
@@ -285,5 +388,6 @@ public class TrackerRemote extends VRPNDevice implements Runnable
 	protected final static Object notifyingChangeListenersLock = new Object( );
 	protected final static Object notifyingVelocityListenersLock = new Object( );
 	protected final static Object notifyingAccelerationListenersLock = new Object( );
+	protected final static Object notifyingSamplesListenersLock = new Object( );
 		
 }
@@ -7,6 +7,34 @@
 
 jclass jclass_vrpn_TrackerRemote = NULL;
 extern jfieldID jfid_vrpn_VRPNDevice_native_device;
+jfieldID jfid_vrpn_TrackerRemote_native_state = NULL;
+
+// Method ids of the Java handlers, looked up once when the library loads
+// rather than for each report.
+jmethodID jmid_vrpn_TrackerRemote_handleTrackerChange = NULL;
+jmethodID jmid_vrpn_TrackerRemote_handleVelocityChange = NULL;
+jmethodID jmid_vrpn_TrackerRemote_handleAccelerationChange = NULL;
+jmethodID jmid_vrpn_TrackerRemote_handleTrackerSamples = NULL;
+
+// Number of rows of doubles in a sample buffer:  time, sensor, x, y, z,
+// and the four quaternion components.  This must match
+// vrpn.TrackerRemote.SAMPLE_ROWS.
+static const int SAMPLE_ROWS = 9;
+
+// What the handlers need for one vrpn.TrackerRemote.  It is passed to them
+// as userdata and kept in the Java object's 'native_state' field.
+struct TrackerRemoteState
+{
+  jobject jobj;       // global reference to the Java TrackerRemote
+  JNIEnv* env;        // that of the thread in mainloop, while it is there
+
+  // The direct ByteBuffer given to setSampleBuffer, if any.
+  jobject samples;    // global reference to it
+  jdouble* rows;      // SAMPLE_ROWS rows of 'capacity' doubles
+  jint capacity;
+  jint count;
+  jint dropped;
+};
 
 
 //////////////////////////
@@ -55,6 +83,29 @@ JNIEXPORT jint JNICALL JNI_OnLoad_Tracker_Remote( JavaVM* jvm, void* reserved )
     return JNI_ERR;
   }
 
+  // get the ids of the 'native_state' field and the handler methods.
+  // these do not have to be made into global references.
+  jfid_vrpn_TrackerRemote_native_state = env->GetFieldID( cls, "native_state", "J" );
+  jmid_vrpn_TrackerRemote_handleTrackerChange
+    = env->GetMethodID( cls, "handleTrackerChange", "(JJIDDDDDDD)V" );
+  jmid_vrpn_TrackerRemote_handleVelocityChange
+    = env->GetMethodID( cls, "handleVelocityChange", "(JJIDDDDDDDD)V" );
+  jmid_vrpn_TrackerRemote_handleAccelerationChange
+    = env->GetMethodID( cls, "handleAccelerationChange", "(JJIDDDDDDDD)V" );
+  jmid_vrpn_TrackerRemote_handleTrackerSamples
+    = env->GetMethodID( cls, "handleTrackerSamples", "(II)V" );
+  if( jfid_vrpn_TrackerRemote_native_state == NULL
+      || jmid_vrpn_TrackerRemote_handleTrackerChange == NULL
+      || jmid_vrpn_TrackerRemote_handleVelocityChange == NULL
+      || jmid_vrpn_TrackerRemote_handleAccelerationChange == NULL
+      || jmid_vrpn_TrackerRemote_handleTrackerSamples == NULL )
+  {
+    printf( "Error loading vrpn TrackerRemote native library "
+            "while looking into class vrpn.TrackerRemote.  "
+            "This may indicate a version mismatch.\n" );
+    return JNI_ERR;
+  }
+
  
   return JAVA_VRPN_JNI_VERSION;
 } // end JNI_OnLoad
@@ -83,12 +134,49 @@ JNIEXPORT void JNICALL JNI_OnUnload_Tracker_Remote( JavaVM* jvm, void* reserved
 // dll utility functions
 
 
+// Returns the JNIEnv to call back into Java with:  that of the mainloop
+// in progress, or else that of this thread, attaching it if need be.
+static JNIEnv* getEnv( TrackerRemoteState* state )
+{
+  if( state->env != NULL )
+    return state->env;
+  JNIEnv* env;
+  jvm->AttachCurrentThread( (void**) &env, NULL );
+  return env;
+}
+
+
 // This is the callback for vrpn to notify us of a new tracker message
 void VRPN_CALLBACK handle_tracker_change( void* userdata, const vrpn_TRACKERCB info )
 {
   if( jvm == NULL )
     return;
 
+  TrackerRemoteState* state = (TrackerRemoteState*) userdata;
+
+  // with a sample buffer set, the report just goes into it.  Java hears
+  // about all of them at once at the end of mainloop.
+  if( state->rows != NULL )
+  {
+    if( state->count >= state->capacity )
+    {
+      state->dropped++;
+      return;
+    }
+    const jint n = state->capacity;
+    jdouble* column = state->rows + state->count++;
+    column[0] = info.msg_time.tv_sec + info.msg_time.tv_usec * 1e-6;
+    column[n] = info.sensor;
+    column[2 * n] = info.pos[0];
+    column[3 * n] = info.pos[1];
+    column[4 * n] = info.pos[2];
+    column[5 * n] = info.quat[0];
+    column[6 * n] = info.quat[1];
+    column[7 * n] = info.quat[2];
+    column[8 * n] = info.quat[3];
+    return;
+  }
+
   /*
   printf( "tracker change (C):  time:  %d.%d;  sensor:  %d;\n"
           "\tpos: %f %f %f;\n"
@@ -97,19 +185,9 @@ void VRPN_CALLBACK handle_tracker_change( void* userdata, const vrpn_TRACKERCB i
           info.quat[0], info.quat[1], info.quat[2], info.quat[3] );
   */
 
-  JNIEnv* env;
-  jvm->AttachCurrentThread( (void**) &env, NULL );
-  
-  jobject jobj = (jobject) userdata;
-  jclass jcls = env->GetObjectClass( jobj );
-  jmethodID jmid = env->GetMethodID( jcls, "handleTrackerChange", "(JJIDDDDDDD)V" );
-  if( jmid == NULL )
-  {
-    printf( "Warning:  vrpn_TrackerRemote library was unable to find the "
-            "Java method \'handleTrackerChange\'.  This may indicate a version mismatch.\n" );
-    return;
-  }
-  env->CallVoidMethod( jobj, jmid, (jlong) info.msg_time.tv_sec, (jlong) info.msg_time.tv_usec,
+  JNIEnv* env = getEnv( state );
+  env->CallVoidMethod( state->jobj, jmid_vrpn_TrackerRemote_handleTrackerChange,
+                       (jlong) info.msg_time.tv_sec, (jlong) info.msg_time.tv_usec,
                        (jint) info.sensor, (jdouble) info.pos[0], (jdouble) info.pos[1], 
                        (jdouble) info.pos[2], (jdouble) info.quat[0], (jdouble) info.quat[1], 
                        (jdouble) info.quat[2], (jdouble) info.quat[3] );
@@ -131,20 +209,10 @@ void VRPN_CALLBACK handle_velocity_change( void* userdata, const vrpn_TRACKERVEL
           info.vel_quat[0], info.vel_quat[1], info.vel_quat[2], info.vel_quat[3], info.vel_quat_dt );
   */
 
-  
-  JNIEnv* env;
-  jvm->AttachCurrentThread( (void**) &env, NULL );
-  
-  jobject jobj = (jobject) userdata;
-  jclass jcls = env->GetObjectClass( jobj );
-  jmethodID jmid = env->GetMethodID( jcls, "handleVelocityChange", "(JJIDDDDDDDD)V" );
-  if( jmid == NULL )
-  {
-    printf( "Warning:  vrpn_TrackerRemote library was unable to find the "
-            "Java method \'handleVelocityChange\'.  This may indicate a version mismatch.\n" );
-    return;
-  }
-  env->CallVoidMethod( jobj, jmid, (jlong) info.msg_time.tv_sec, (jlong) info.msg_time.tv_usec,
+  TrackerRemoteState* state = (TrackerRemoteState*) userdata;
+  JNIEnv* env = getEnv( state );
+  env->CallVoidMethod( state->jobj, jmid_vrpn_TrackerRemote_handleVelocityChange,
+                       (jlong) info.msg_time.tv_sec, (jlong) info.msg_time.tv_usec,
                        (jint) info.sensor, (jdouble) info.vel[0], (jdouble) info.vel[1], 
                        (jdouble) info.vel[2], (jdouble) info.vel_quat[0], (jdouble) info.vel_quat[1], 
                        (jdouble) info.vel_quat[2], (jdouble) info.vel_quat[3], (jdouble) info.vel_quat_dt );
@@ -166,20 +234,10 @@ void VRPN_CALLBACK handle_acceleration_change( void* userdata, const vrpn_TRACKE
           info.acc_quat[0], info.acc_quat[1], info.acc_quat[2], info.acc_quat[3], info.acc_quat_dt );
   */
 
-  
-  JNIEnv* env;
-  jvm->AttachCurrentThread( (void**) &env, NULL );
-  
-  jobject jobj = (jobject) userdata;
-  jclass jcls = env->GetObjectClass( jobj );
-  jmethodID jmid = env->GetMethodID( jcls, "handleAccelerationChange", "(JJIDDDDDDDD)V" );
-  if( jmid == NULL )
-  {
-    printf( "Warning:  vrpn_TrackerRemote library was unable to find the "
-            "Java method \'handleAccelerationChange\'.  This may indicate a version mismatch.\n" );
-    return;
-  }
-  env->CallVoidMethod( jobj, jmid, (jlong) info.msg_time.tv_sec, (jlong) info.msg_time.tv_usec,
+  TrackerRemoteState* state = (TrackerRemoteState*) userdata;
+  JNIEnv* env = getEnv( state );
+  env->CallVoidMethod( state->jobj, jmid_vrpn_TrackerRemote_handleAccelerationChange,
+                       (jlong) info.msg_time.tv_sec, (jlong) info.msg_time.tv_usec,
                        (jint) info.sensor, (jdouble) info.acc[0], (jdouble) info.acc[1], 
                        (jdouble) info.acc[2], (jdouble) info.acc_quat[0], (jdouble) info.acc_quat[1], 
                        (jdouble) info.acc_quat[2], (jdouble) info.acc_quat[3], (jdouble) info.acc_quat_dt );
@@ -213,8 +271,57 @@ Java_vrpn_TrackerRemote_mainloop( JNIEnv* env, jobject jobj )
   if( t <= 0 )  // this tracker is uninitialized or has been shut down already
     return;
 
-  // now call mainloop
+  jlong jstate = env->GetLongField( jobj, jfid_vrpn_TrackerRemote_native_state );
+  if( jstate <= 0 )
+    return;
+  TrackerRemoteState* state = (TrackerRemoteState*) jstate;
+
+  // now call mainloop, letting the handlers use this thread's env
+  state->env = env;
   t->mainloop( );
+  state->env = NULL;
+
+  // hand the reports stored into the sample buffer over in one call
+  if( state->rows != NULL && (state->count > 0 || state->dropped > 0) )
+  {
+    env->CallVoidMethod( jobj, jmid_vrpn_TrackerRemote_handleTrackerSamples,
+                         state->count, state->dropped );
+    state->count = 0;
+    state->dropped = 0;
+  }
+}
+
+
+JNIEXPORT jboolean JNICALL 
+Java_vrpn_TrackerRemote_setSampleBuffer_1native( JNIEnv* env, jobject jobj, jobject jsamples )
+{
+  jlong jstate = env->GetLongField( jobj, jfid_vrpn_TrackerRemote_native_state );
+  if( jstate <= 0 )
+    return false;
+  TrackerRemoteState* state = (TrackerRemoteState*) jstate;
+
+  jdouble* rows = NULL;
+  jint capacity = 0;
+  if( jsamples != NULL )
+  {
+    rows = (jdouble*) env->GetDirectBufferAddress( jsamples );
+    capacity = (jint) (env->GetDirectBufferCapacity( jsamples ) / (SAMPLE_ROWS * sizeof(jdouble)));
+    if( rows == NULL || capacity <= 0 )
+    {
+      printf( "Error in native method \"setSampleBuffer\":  the sample buffer "
+              "must be a direct buffer with room for at least one sample.\n" );
+      return false;
+    }
+  }
+
+  if( state->samples != NULL )
+    env->DeleteGlobalRef( state->samples );
+  state->samples = jsamples == NULL ? NULL : env->NewGlobalRef( jsamples );
+  state->rows = rows;
+  state->capacity = capacity;
+  state->count = 0;
+  state->dropped = 0;
+  return true;
 }
 
 
@@ -242,9 +349,17 @@ Java_vrpn_TrackerRemote_init( JNIEnv* env, jobject jobj, jstring jname,
 	  = vrpn_get_connection_by_name( name, local_in_logfile_name, local_out_logfile_name,
 									 remote_in_logfile_name, remote_out_logfile_name );
   vrpn_Tracker_Remote* t = new vrpn_Tracker_Remote( name, conn );
-  t->register_change_handler( jobj, handle_tracker_change );
-  t->register_change_handler( jobj, handle_velocity_change );
-  t->register_change_handler( jobj, handle_acceleration_change );
+  TrackerRemoteState* state = new TrackerRemoteState;
+  state->jobj = jobj;
+  state->env = NULL;
+  state->samples = NULL;
+  state->rows = NULL;
+  state->capacity = 0;
+  state->count = 0;
+  state->dropped = 0;
+  t->register_change_handler( state, handle_tracker_change );
+  t->register_change_handler( state, handle_velocity_change );
+  t->register_change_handler( state, handle_acceleration_change );
   env->ReleaseStringUTFChars( jname, name );
   env->ReleaseStringUTFChars( jlocalInLogfileName, local_in_logfile_name );
   env->ReleaseStringUTFChars( jlocalOutLogfileName, local_out_logfile_name );
@@ -254,6 +369,7 @@ Java_vrpn_TrackerRemote_init( JNIEnv* env, jobject jobj, jstring jname,
   // now stash 't' in the jobj's 'native_device' field
   jlong jt = (jlong) t;
   env->SetLongField( jobj, jfid_vrpn_VRPNDevice_native_device, jt );
+  env->SetLongField( jobj, jfid_vrpn_TrackerRemote_native_state, (jlong) state );
   
   return true;
 }
@@ -268,12 +384,15 @@ Java_vrpn_TrackerRemote_shutdownTracker( JNIEnv* env, jobject jobj )
   // get the tracker pointer
   vrpn_Tracker_Remote* t = (vrpn_Tracker_Remote*) env->GetLongField( jobj, jfid_vrpn_VRPNDevice_native_device );
   
+  jlong jstate = env->GetLongField( jobj, jfid_vrpn_TrackerRemote_native_state );
+  TrackerRemoteState* state = (TrackerRemoteState*) jstate;
+  
   // unregister a handler and destroy the tracker
   if( t > 0 )
   {
-    t->unregister_change_handler( jobj, handle_tracker_change );
-    t->unregister_change_handler( jobj, handle_velocity_change );
-    t->unregister_change_handler( jobj, handle_acceleration_change );
+    t->unregister_change_handler( state, handle_tracker_change );
+    t->unregister_change_handler( state, handle_velocity_change );
+    t->unregister_change_handler( state, handle_acceleration_change );
 	t->connectionPtr()->removeReference(); // because we called vrpn_get_connection_by_name
     delete t;
   }
@@ -281,8 +400,16 @@ Java_vrpn_TrackerRemote_shutdownTracker( JNIEnv* env, jobject jobj )
   // set the tracker pointer to -1
   env->SetLongField( jobj, jfid_vrpn_VRPNDevice_native_device, -1 );
 
-  // delete global reference to object (that was created in init)
-  env->DeleteGlobalRef( jobj );
+  // delete the global references to the sample buffer and the object
+  // (that was created in init)
+  if( jstate > 0 )
+  {
+    if( state->samples != NULL )
+      env->DeleteGlobalRef( state->samples );
+    env->DeleteGlobalRef( state->jobj );
+    delete state;
+  }
+  env->SetLongField( jobj, jfid_vrpn_TrackerRemote_native_state, -1 );
 
 
 }
@@ -0,0 +1,67 @@
+#!/usr/bin/python
+#
+# Compares the two ways of reading a tracker from Python: a callback for
+# each report, and Tracker.drain(), which stores all the reports a mainloop
+# brings in into a buffer of 9 rows of doubles (time, sensor, x, y, z, qx,
+# qy, qz, qw).  The buffer can be any writable buffer of doubles: an
+# array.array('d') as here, or a numpy.empty((9, n)).
+#
+# Start the server from client_src first, which sends a burst of reports
+# every millisecond:
+#	c_interface_bench -serve 4701
+# then run
+#	python bench_tracker_drain.py [Tracker0@localhost:4701]
+
+import array
+import sys
+import time
+
+import vrpn
+
+SECONDS = 3
+CAPACITY = 4096
+
+count = [0]
+
+def callback(userdata, data):
+    count[0] += 1
+
+# Runs step() for a while and returns the samples per second of time spent
+# in the calls that brought samples in; calls that found nothing are left
+# out, as they cost the same either way.
+def run(tracker, step):
+    # Let the connection come up and the backlog clear before timing
+    end = time.time() + 1
+    while time.time() < end:
+        step()
+    count[0] = 0
+    busy = 0.0
+    end = time.time() + SECONDS
+    while time.time() < end:
+        before = count[0]
+        start = time.time()
+        step()
+        if count[0] != before:
+            busy += time.time() - start
+        else:
+            time.sleep(0.0002)
+    return count[0] / busy
+
+name = "Tracker0@localhost:4701"
+if len(sys.argv) > 1:
+    name = sys.argv[1]
+
+tracker = vrpn.receiver.Tracker(name)
+tracker.register_change_handler(None, callback, "position")
+callback_rate = run(tracker, tracker.mainloop)
+tracker.unregister_change_handler(None, callback, "position")
+
+samples = array.array('d', [0.0]) * (9 * CAPACITY)
+def drain():
+    received, dropped = tracker.drain(samples)
+    count[0] += received + dropped
+drain_rate = run(tracker, drain)
+
+print("Samples/sec of mainloop time:")
+print("  callback:  %10.0f" % callback_rate)
+print("  drain():   %10.0f" % drain_rate)
@@ -18,6 +18,7 @@ namespace vrpn_python {
     {"mainloop", (PyCFunction)Tracker::_definition::mainloop, METH_NOARGS, "Run the mainloop" },
     {"register_change_handler", (PyCFunction)Tracker::_definition::register_change_handler, METH_VARARGS, "Register a callback handler to handle a position change" },
     {"unregister_change_handler", (PyCFunction)Tracker::_definition::unregister_change_handler, METH_VARARGS, "Unregister a callback handler to handle a position change" },
+    {"drain", (PyCFunction)Tracker::drain, METH_VARARGS, "Run the mainloop, storing the position reports into a writable buffer of doubles laid out as 9 rows (time, sensor, x, y, z, qx, qy, qz, qw), such as numpy.empty((9, n)) ; returns (count, dropped)" },
     WRAPPER_REQUEST(request_t2r_xform, "request room from tracker xforms"),
     WRAPPER_REQUEST(request_u2s_xform, "request all available sensor from unit xforms"),
     WRAPPER_REQUEST(request_workspace, "request workspace bounding box"),
@@ -39,7 +40,75 @@ namespace vrpn_python {
     return name;
   }
 
-  Tracker::Tracker(PyObject *error, PyObject * args) : Device(error, args), d_device(NULL) {
+  Tracker::Tracker(PyObject *error, PyObject * args) : Device(error, args), d_device(NULL),
+						      d_drain_registered(false), d_drain_rows(NULL),
+						      d_drain_capacity(0), d_drain_count(0), d_drain_dropped(0) {
+  }
+
+  // Number of rows, of d_drain_capacity doubles each, in a drain() buffer
+  static const unsigned DRAIN_ROWS = 9;
+
+  void VRPN_CALLBACK Tracker::drain_handler(void *userdata, const vrpn_TRACKERCB info) {
+    Tracker *self = (Tracker *)userdata;
+    if (!self->d_drain_rows) {
+      return;
+    }
+    if (self->d_drain_count >= self->d_drain_capacity) {
+      self->d_drain_dropped++;
+      return;
+    }
+    const unsigned n = self->d_drain_capacity;
+    double *column = self->d_drain_rows + self->d_drain_count++;
+    column[0] = info.msg_time.tv_sec + info.msg_time.tv_usec * 1e-6;
+    column[n] = info.sensor;
+    column[2 * n] = info.pos[0];
+    column[3 * n] = info.pos[1];
+    column[4 * n] = info.pos[2];
+    column[5 * n] = info.quat[0];
+    column[6 * n] = info.quat[1];
+    column[7 * n] = info.quat[2];
+    column[8 * n] = info.quat[3];
+  }
+
+  // Runs the mainloop with the position reports going straight into the
+  // caller's buffer, rather than through a dictionary and a Python call
+  // for each of them.
+  PyObject *Tracker::drain(PyObject *obj, PyObject *args) {
+    Py_buffer view;
+    try {
+      Tracker *self = _definition::get(obj);
+
+      static std::string defaultCall("invalid call : drain(buffer)");
+      if ((!args) || (!PyArg_ParseTuple(args, "w*", &view))) {
+	DeviceException::launch(defaultCall);
+      }
+      if ((view.len == 0) || (view.len % (DRAIN_ROWS * sizeof(double)) != 0)) {
+	PyBuffer_Release(&view);
+	DeviceException::launch("Tracker : drain buffer must hold 9 rows of doubles");
+      }
+
+      if (!self->d_drain_registered) {
+	self->d_device->register_change_handler(self, drain_handler);
+	self->d_drain_registered = true;
+      }
+      self->d_drain_rows = (double *)view.buf;
+      self->d_drain_capacity = (unsigned)(view.len / (DRAIN_ROWS * sizeof(double)));
+      self->d_drain_count = 0;
+      self->d_drain_dropped = 0;
+      try {
+	self->d_device->mainloop();
+      } catch (CallbackException) {
+	self->d_drain_rows = NULL;
+	PyBuffer_Release(&view);
+	return NULL;
+      }
+      self->d_drain_rows = NULL;
+      PyBuffer_Release(&view);
+      return Py_BuildValue("(II)", self->d_drain_count, self->d_drain_dropped);
+    } catch (DeviceException &exception) {
+      PyErr_SetString(Device::s_error, exception.getReason().c_str());
+    }
+    return NULL;
   }
 
   PyObject * Tracker::work_on_change_handler(bool add, PyObject *obj, PyObject *args) {
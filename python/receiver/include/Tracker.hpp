@@ -12,6 +12,14 @@ namespace vrpn_python {
     friend class definition<Tracker>;
     vrpn_type *d_device;
 
+    // Where drain() is storing reports while it runs mainloop
+    bool d_drain_registered;
+    double *d_drain_rows;
+    unsigned d_drain_capacity;
+    unsigned d_drain_count;
+    unsigned d_drain_dropped;
+    static void VRPN_CALLBACK drain_handler(void *userdata, const vrpn_TRACKERCB info);
+
     Tracker(PyObject *error, PyObject * args);
 
     static PyTypeObject &getType();
@@ -27,6 +35,7 @@ namespace vrpn_python {
     static PyObject *request_u2s_xform(PyObject *obj);
     static PyObject *request_workspace(PyObject *obj);
     static PyObject *reset_origin(PyObject *obj);
+    static PyObject *drain(PyObject *obj, PyObject *args);
 
     typedef definition<Tracker> _definition;
   };
@@ -85,6 +85,13 @@ public:
   bool updateChanges();
   // --------------------------------------------------
 
+  // --- modify many at once --------------------------
+  // verts holds numVerts x,y,z triples, each multiplied by scale
+  bool setVertices(int firstVert,int numVerts,const float *verts,double scale=1.0);
+  // tris holds numTris vertex-index triples
+  bool setTriangles(int firstTri,int numTris,const int *tris);
+  // --------------------------------------------------
+
   bool getVertex(int vertNum, float &x,float &y,float &z);
 
   // if HCOLLIDE = ourType, returns the id of the triangle the probe is contacting
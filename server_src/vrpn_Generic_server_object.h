@@ -6,6 +6,8 @@
 #include <string.h>
 #include <stdio.h>
 #include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #include "vrpn_MainloopContainer.h"
 
@@ -21,6 +23,7 @@
 #include "vrpn_Poser.h"
 #include "vrpn_3Space.h"
 #include "vrpn_Tracker_Fastrak.h"
+#include "vrpn_Tracker_Filter.h"
 #include "vrpn_Tracker_Isotrak.h"
 #include "vrpn_Tracker_Liberty.h"
 #include "vrpn_Tracker_LibertyHS.h"
@@ -159,9 +162,43 @@ const int VRPN_GSO_MAX_INERTIAMOUSES =        8;
 const int VRPN_GSO_MAX_JSONNETS =			  4;
 #endif
 
+// Most threads used to open and reset devices at the same time.
+const int VRPN_GSO_MAX_STARTUP_THREADS =      16;
+
+class vrpn_Generic_Server_Object;
+struct vrpn_GSO_Config_Entry;
+struct vrpn_GSO_Startup;
+struct vrpn_GSO_Request;
+
+// Messages on the control channel of vrpn_Generic_Server_Object (see
+// enable_control()).  The requests hold a NUL-terminated string: the config
+// file text of the devices to add, or the name of the device to remove or
+// restart.  Each is answered by a result holding a vrpn_int32 (0 for
+// success, -1 for failure) and a NUL-terminated string saying what happened.
+const char * const vrpn_GSO_CONTROL_ADD =     "vrpn_Server_Control add_devices";
+const char * const vrpn_GSO_CONTROL_REMOVE =  "vrpn_Server_Control remove_device";
+const char * const vrpn_GSO_CONTROL_RESTART = "vrpn_Server_Control restart_device";
+const char * const vrpn_GSO_CONTROL_RESULT =  "vrpn_Server_Control result";
+
+// Function that parses one entry of the configuration file and creates the
+// device it describes.
+typedef int (vrpn_Generic_Server_Object::*vrpn_GSO_SETUP) (char * & pch, char * line, FILE * config_file);
+
+// Flags describing a kind of device in the configuration file.
+const unsigned vrpn_GSO_READS_LINES = 1;  // Its entry goes on past the first line
+const unsigned vrpn_GSO_PARALLEL = 2;     // Can be opened and reset on its own thread
+
+// One kind of device that can appear in the configuration file.
+struct vrpn_GSO_Device_Type {
+  const char      *name;    // Class name that starts the entry
+  vrpn_GSO_SETUP  setup;    // Parses the entry and creates the device
+  unsigned        flags;    // vrpn_GSO_READS_LINES, vrpn_GSO_PARALLEL
+};
+
 class vrpn_Generic_Server_Object
 {
   public:
+    // A NULL config_file_name makes a server with no devices.
     vrpn_Generic_Server_Object (vrpn_Connection *connection_to_use, const char *config_file_name = "vrpn.cfg", int port = vrpn_DEFAULT_LISTEN_PORT_NO, bool be_verbose = false, bool bail_on_open_error = false);
     ~vrpn_Generic_Server_Object();
 
@@ -170,6 +207,26 @@ class vrpn_Generic_Server_Object
       return d_doing_okay;
     }
 
+    // Devices can be added, removed and restarted while the server runs,
+    // without dropping its connections.  add_devices() takes the text of
+    // one or more config file entries; the others take the name of a
+    // device.  Each returns 0 on success and -1 on failure.  Devices that
+    // can be (see vrpn_GSO_PARALLEL) are opened and reset on a thread of
+    // their own while the others keep running, and start running in a
+    // later mainloop().  The connection never forgets a sender name, so a
+    // device that is restarted or added again keeps its sender ID.
+    int add_devices (const char *config_text);
+    int remove_device (const char *name);
+    int restart_device (const char *name);
+
+    // Takes requests to do the above in messages from the given sender on
+    // the connection (see vrpn_GSO_CONTROL_ADD and the others above).
+    void enable_control (const char *sender_name);
+
+    // Watches the config file and, when it changes, starts the entries that
+    // are new or changed and removes those that are gone from it.
+    void watch_config_file (bool watch);
+
   protected:
     vrpn_Connection *connection;          //< Connection to communicate on
     bool            d_doing_okay;         //< Is the object working okay?
@@ -260,6 +317,50 @@ class vrpn_Generic_Server_Object
 
     void closeDevices (void);
 
+    // Every kind of device the configuration file can name, and a lookup
+    // of one by its class name (NULL if there is no such kind).
+    static const vrpn_GSO_Device_Type d_device_types[];
+    static const vrpn_GSO_Device_Type *find_device_type (const char *name);
+
+    // Entries of the config file, and any added since.  Each entry's devices
+    // are created in a server object of their own, which is run from
+    // _devices once it has started.
+    vrpn_GSO_Config_Entry **d_entries;
+    int     d_num_entries;
+    int     d_max_entries;
+    vrpn_GSO_Startup *d_startups;   //< Entries being started on threads
+    bool    d_owns_wait_lock;       //< Did we set the device-wait lock?
+
+    void read_config_file (FILE * config_file);
+    int split_config_file (FILE * config_file, vrpn_GSO_Config_Entry ** &entries, int &num_entries);
+    int start_entries (vrpn_GSO_Config_Entry **entries, int num_entries, FILE * config_file, bool wait, bool reply);
+    bool finish_startup (vrpn_GSO_Startup *startup);
+    static void startup_thread (vrpn_ThreadData &threadData);
+    static void run_entry (vrpn_GSO_Config_Entry *entry);
+    void report_startup_times (vrpn_GSO_Config_Entry * const *entries, int num_entries, double total_secs);
+    void add_entry (vrpn_GSO_Config_Entry *entry);
+    void remove_entry (int which);
+    int do_add (const char *config_text, bool reply);
+    int do_remove (const char *name, bool reply);
+    int do_restart (const char *name, bool reply);
+
+    // The control channel
+    bool    d_control;              //< Are we taking requests?
+    vrpn_int32 d_control_sender;
+    vrpn_int32 d_add_type, d_remove_type, d_restart_type, d_result_type;
+    vrpn_GSO_Request *d_requests;   //< Waiting for mainloop()
+    static int VRPN_CALLBACK handle_control (void *userdata, vrpn_HANDLERPARAM p);
+    void do_requests (void);
+    void send_control_result (vrpn_int32 status, const char *text);
+
+    // Watching the config file
+    char    *d_config_file_name;
+    bool    d_watching;
+    time_t  d_config_mtime;
+    off_t   d_config_size;
+    struct timeval d_last_watch;
+    void check_config_file (void);
+
     // Helper functions for the functions below
     int   get_AFline (char *line, vrpn_TAF_axis *axis);
     int	get_poser_axis_line (FILE *config_file, const char *axis_name, vrpn_PA_axis *axis, vrpn_float64 *min, vrpn_float64 *max);
@@ -269,6 +370,7 @@ class vrpn_Generic_Server_Object
     int setup_raw_SGIBox (char * & pch, char * line, FILE * config_file);
     int setup_SGIBox (char * & pch, char * line, FILE * config_file);
     int setup_Tracker_AnalogFly (char * & pch, char * line, FILE * config_file);
+    int setup_Tracker_Filter (char * & pch, char * line, FILE * config_file);
     int setup_Tracker_ButtonFly (char * & pch, char * line, FILE * config_file);
     int setup_Joystick (char * & pch, char * line, FILE * config_file);
     int setup_Example_Button (char * & pch, char * line, FILE * config_file);
@@ -348,7 +450,7 @@ class vrpn_Generic_Server_Object
     int setup_DreamCheeky (char * & pch, char * line, FILE * config_file) ;
     int setup_Tracker_NovintFalcon (char * & pch, char * line, FILE * config_file);
     int setup_Tracker_TrivisioColibri (char * &pch, char * line, FILE * config_file);
-    int setup_Tracker_GameTrak (char *pch, char *line, FILE * config_file);
+    int setup_Tracker_GameTrak (char * &pch, char * line, FILE * config_file);
     int setup_LUDL_USBMAC6000 (char * &pch, char * line, FILE * config_file);
     int setup_Analog_5dtUSB_Glove5Left (char * &pch, char * line, FILE * config_file);
     int setup_Analog_5dtUSB_Glove5Right (char * &pch, char * line, FILE * config_file);
@@ -364,8 +466,8 @@ class vrpn_Generic_Server_Object
     int setup_inertiamouse (char * & pch, char * line, FILE * config_file);
 
     // Polhemus additions
-    int setup_Tracker_G4(char* &pch, char* line, FILE* config_file); 
-    int setup_Tracker_LibertyPDI(char* &pch, char* line, FILE* config_file); 
+    int setup_Tracker_G4(char* &pch, char* line, FILE* config_file); 
+    int setup_Tracker_LibertyPDI(char* &pch, char* line, FILE* config_file); 
     int setup_Tracker_FastrakPDI(char* &pch, char* line, FILE* config_file); 
 
 #ifdef VRPN_USE_JSONNET
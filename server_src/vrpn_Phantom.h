@@ -143,6 +143,10 @@ protected:
     virtual bool setTriangle(vrpn_int32 objNum, vrpn_int32 triNum,vrpn_int32 vert0,vrpn_int32 vert1,vrpn_int32 vert2,
 		  vrpn_int32 norm0,vrpn_int32 norm1,vrpn_int32 norm2);
     virtual bool removeTriangle(vrpn_int32 objNum, vrpn_int32 triNum); 
+	virtual bool setVertices(vrpn_int32 objNum, vrpn_int32 firstVert, vrpn_int32 numVerts,
+		  const vrpn_float32 *verts);
+	virtual bool setTriangles(vrpn_int32 objNum, vrpn_int32 firstTri, vrpn_int32 numTris,
+		  const vrpn_int32 *tris);
     // should be called to incorporate the above changes into the 
     // displayed trimesh 
     virtual bool updateTrimeshChanges(vrpn_int32 objNum,vrpn_float32 kspring, vrpn_float32 kdamp, vrpn_float32 fdyn, vrpn_float32 fstat);
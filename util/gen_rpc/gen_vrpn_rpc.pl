@@ -1304,6 +1304,363 @@ sub writeBaseClassFiles (;$)
   1;
 }
 
+#--------------------------------------------------------------
+# Message codecs.  With -t, a header is written holding a class named
+# for the message group with a structure for each message.  The structure
+# has the message's fields and inline functions to encode them, to decode
+# them, and to read them in place from a received buffer (its View).
+# The size of the fields that do not depend on a count is worked out at
+# compile time, and arrays are converted to and from network byte order
+# all at once; see the vrpn_codec routines in vrpn_BufferUtils.h.
+# Messages that include a structure are not handled.
+
+# C++ type of a field.
+sub codecType ($)
+{
+  my $vartype = $_[0];
+  return ((($vartype eq "char") || ($vartype eq "timeval")) ? "" : "vrpn_")
+      . $vartype;
+}
+
+# Returns 1 if the field is an array with a variable count.
+sub codecIsVariable ($)
+{
+  my $thisarg = $_[0];
+  return defined(@$thisarg[4]->[0]) ? 1 : 0;
+}
+
+# Returns 1 if the field is an array.
+sub codecIsArray ($)
+{
+  my $thisarg = $_[0];
+  return (defined(@$thisarg[3]->[0]) || defined(@$thisarg[4]->[0])) ? 1 : 0;
+}
+
+# Finds the field with the given name, or returns undef.
+sub codecFindField ($$)
+{
+  my $fieldarray = $_[0];
+  my $name = $_[1];
+  foreach $morearg (@$fieldarray) {
+    return $morearg if (@$morearg[2] eq $name);
+  }
+  return undef;
+}
+
+# Expression for the number of elements in an array field.  Counts come
+# from the structure's members, or with $viewFlag from the view's pointers
+# into the buffer.
+sub codecCount ($$;$)
+{
+  my $thisarg = $_[0];
+  my $fieldarray = $_[1];
+  my $viewFlag = $_[2];
+  my @terms = ();
+  foreach ( @{@$thisarg[3]} , @{@$thisarg[4]} ) {
+    my $countvar = @$_[2];
+    if (@$_[0] eq "variableCount") {
+      if ($viewFlag) {
+        my $countarg = codecFindField($fieldarray, $countvar);
+        $countvar = "vrpn_codec::read<" . codecType(@$countarg[1]) . ">(d_"
+            . $countvar . ")";
+      }
+      push @terms, "vrpn_codec::count(" . $countvar . ")";
+    } else {
+      push @terms, $countvar;
+    }
+  }
+  return join(" * ", @terms);
+}
+
+# Expression for the bytes a field takes on the wire.
+sub codecSize ($$;$)
+{
+  my $thisarg = $_[0];
+  my $size = "vrpn_codec::wire_size<" . codecType(@$thisarg[1]) . ">::value";
+  if (codecIsArray($thisarg)) {
+    $size .= " * " . codecCount($thisarg, $_[1], $_[2]);
+  }
+  return $size;
+}
+
+# Pointer to the first element of an array member.
+sub codecFirst ($)
+{
+  my $thisarg = $_[0];
+  if (codecIsVariable($thisarg)) {
+    return @$thisarg[2];
+  }
+  return "&" . @$thisarg[2] . ("[0]" x ($#{@$thisarg[3]} + 1));
+}
+
+# Names of the count fields that variable arrays depend on, each once.
+sub codecCountNames ($)
+{
+  my $fieldarray = $_[0];
+  my @names = ();
+  my %seen = ();
+  foreach $thisarg (@$fieldarray) {
+    foreach (@{@$thisarg[4]}) {
+      my $countvar = @$_[2];
+      if (!$seen{$countvar}) {
+        $seen{$countvar} = 1;
+        push @names, $countvar;
+      }
+    }
+  }
+  return @names;
+}
+
+# Emits the structure for one message.
+sub emitCodec ($)
+{
+  my $msgarray = $_[0];
+  my $typeName = @$msgarray[2]->[1];
+  my $fieldarray = @$msgarray[4]->[1];
+
+  if (defined(@$msgarray[4]->[2])) {
+    print "  // $typeName: messages with structures have no codec.\n\n";
+    return 1;
+  }
+  my @countNames = codecCountNames($fieldarray);
+  foreach (@countNames) {
+    if (!defined(codecFindField($fieldarray, $_))) {
+      print "  // $typeName: the count $_ is not in the message, so it has no codec.\n\n";
+      return 1;
+    }
+  }
+  my @fixed = grep { !codecIsVariable($_) } @$fieldarray;
+  my $fixedSize = join("\n      + ", map { codecSize($_, $fieldarray) } @fixed);
+  if ($fixedSize eq "") { $fixedSize = "0"; }
+  my $hasVariable = ($#countNames >= 0);
+
+  print "  struct $typeName {\n";
+  foreach $thisarg (@$fieldarray) {
+    print "    " . codecType(@$thisarg[1]) . " ";
+    if (codecIsVariable($thisarg)) {
+      print "* " . @$thisarg[2];
+    } else {
+      print @$thisarg[2];
+      if (codecIsArray($thisarg)) { print " "; }
+      foreach $dim (@{@$thisarg[3]}) {
+        print join("", @$dim[1..3]);
+      }
+    }
+    print ";\n";
+  }
+  if ($#$fieldarray >= 0) { print "\n"; }
+
+  print "    // Bytes taken by the fields whose size does not depend on a count.\n";
+  print "    enum { fixed_size = $fixedSize };\n\n";
+
+  print "    // Bytes the message takes on the wire.\n";
+  print "    vrpn_uint32 size (void) const {\n";
+  print "      return fixed_size";
+  foreach $thisarg (@$fieldarray) {
+    if (codecIsVariable($thisarg)) {
+      print "\n        + " . codecSize($thisarg, $fieldarray);
+    }
+  }
+  print ";\n    }\n\n";
+
+  # Encoder
+  print "    // Encodes the message into buf, which has room for buflen bytes.\n";
+  print "    // Returns the number of bytes used, or -1 if they do not fit.\n";
+  print "    int encode (char * buf, vrpn_uint32 buflen) const {\n";
+  if (!$hasVariable) {
+    if ($fixedSize ne "0") {
+      print "      if (buflen < fixed_size) return -1;\n";
+    }
+  } else {
+    # Each array is checked against the room that is left, so that huge
+    # counts cannot overflow the size.
+    if ($fixedSize ne "0") {
+      print "      if (buflen < fixed_size) return -1;\n";
+    }
+    print "      vrpn_uint32 var_len = 0;\n";
+    foreach $thisarg (@$fieldarray) {
+      if (codecIsVariable($thisarg)) {
+        my $varname = @$thisarg[2];
+        my $elemsize = "vrpn_codec::wire_size<" . codecType(@$thisarg[1]) . ">::value";
+        print "      {\n";
+        print "        vrpn_uint32 n = " . codecCount($thisarg, $fieldarray) . ";\n";
+        print "        if ((n && !$varname) ||\n";
+        print "            (n > (buflen - fixed_size - var_len) / $elemsize)) return -1;\n";
+        print "        var_len += n * $elemsize;\n";
+        print "      }\n";
+      }
+    }
+  }
+  foreach $thisarg (@$fieldarray) {
+    if (codecIsArray($thisarg)) {
+      print "      vrpn_codec::put_array(&buf, " . codecFirst($thisarg) . ", "
+          . codecCount($thisarg, $fieldarray) . ");\n";
+    } else {
+      print "      vrpn_codec::put(&buf, " . @$thisarg[2] . ");\n";
+    }
+  }
+  if ($#$fieldarray < 0) { print "      (void)buf; (void)buflen;\n"; }
+  print "      return " . ($hasVariable ? "static_cast<int>(fixed_size + var_len)"
+                                        : "fixed_size") . ";\n";
+  print "    }\n\n";
+
+  # Decoder
+  print "    // Decodes the message from buf, which holds buflen bytes.\n";
+  if ($hasVariable) {
+    print "    // Variable-length arrays are filled in where their pointers point,\n";
+    print "    // and each count may be no larger than its max_ value.\n";
+  }
+  print "    // Returns the number of bytes read, or -1 if the message is short";
+  print ($hasVariable ? "\n    // or too large.\n" : ".\n");
+  print "    int decode (const char * buf, vrpn_uint32 buflen";
+  foreach (@countNames) {
+    print ", vrpn_uint32 max_$_";
+  }
+  print ") {\n";
+  if ($fixedSize ne "0") {
+    print "      if (buflen < fixed_size) return -1;\n";
+  }
+  if ($hasVariable) {
+    print "      vrpn_uint32 var_len = 0;\n";
+  }
+  my %decoded = ();
+  foreach $thisarg (@$fieldarray) {
+    my $varname = @$thisarg[2];
+    if (codecIsVariable($thisarg)) {
+      my $vartype = codecType(@$thisarg[1]);
+      my $elemsize = "vrpn_codec::wire_size<$vartype>::value";
+      print "      {\n";
+      my %checked = ();
+      foreach (@{@$thisarg[4]}) {
+        my $countvar = @$_[2];
+        next if ($checked{$countvar});
+        $checked{$countvar} = 1;
+        print "        if (vrpn_codec::count($countvar) > max_$countvar) return -1;\n";
+      }
+      print "        vrpn_uint32 n = " . codecCount($thisarg, $fieldarray) . ";\n";
+      print "        if ((n && !$varname) ||\n";
+      print "            (n > (buflen - fixed_size - var_len) / $elemsize)) return -1;\n";
+      print "        vrpn_codec::get_array(&buf, $varname, n);\n";
+      print "        var_len += n * $elemsize;\n";
+      print "      }\n";
+    } elsif (codecIsArray($thisarg)) {
+      print "      vrpn_codec::get_array(&buf, " . codecFirst($thisarg) . ", "
+          . codecCount($thisarg, $fieldarray) . ");\n";
+    } else {
+      print "      vrpn_codec::get(&buf, &$varname);\n";
+    }
+  }
+  if ($#$fieldarray < 0) { print "      (void)buf; (void)buflen;\n"; }
+  print "      return " . ($hasVariable ? "static_cast<int>(fixed_size + var_len)"
+                                        : "fixed_size") . ";\n";
+  print "    }\n\n";
+
+  # View
+  print "    // Reads the message in place from a received buffer, converting\n";
+  print "    // each value as it is asked for.\n";
+  print "    class View {\n";
+  print "      public:\n";
+  if ($#$fieldarray >= 0) {
+    print "        View (void) : ";
+    print join(", ", map { "d_" . @$_[2] . "(NULL)" } @$fieldarray);
+    print " {}\n\n";
+  }
+  print "        // Points the view at buf, which holds buflen bytes.  Returns\n";
+  print "        // the number of bytes the message takes, or -1 if it is short.\n";
+  print "        int attach (const char * buf, vrpn_uint32 buflen) {\n";
+  if ($fixedSize ne "0") {
+    print "          if (buflen < fixed_size) return -1;\n";
+  }
+  if ($hasVariable) {
+    print "          vrpn_uint32 var_len = 0;\n";
+  }
+  foreach $thisarg (@$fieldarray) {
+    my $varname = @$thisarg[2];
+    print "          d_$varname = buf;\n";
+    if (codecIsVariable($thisarg)) {
+      my $elemsize = "vrpn_codec::wire_size<" . codecType(@$thisarg[1]) . ">::value";
+      print "          d_${varname}_count = " . codecCount($thisarg, $fieldarray, 1) . ";\n";
+      print "          if (d_${varname}_count > (buflen - fixed_size - var_len) / $elemsize) return -1;\n";
+      print "          var_len += d_${varname}_count * $elemsize;\n";
+      print "          buf += d_${varname}_count * $elemsize;\n";
+    } else {
+      print "          buf += " . codecSize($thisarg, $fieldarray) . ";\n";
+    }
+  }
+  if ($#$fieldarray < 0) { print "          (void)buf; (void)buflen;\n"; }
+  print "          return " . ($hasVariable ? "static_cast<int>(fixed_size + var_len)"
+                                          : "fixed_size") . ";\n";
+  print "        }\n";
+  if ($#$fieldarray >= 0) { print "\n"; }
+  foreach $thisarg (@$fieldarray) {
+    my $varname = @$thisarg[2];
+    my $vartype = codecType(@$thisarg[1]);
+    if (codecIsVariable($thisarg)) {
+      print "        vrpn_codec::array<$vartype> $varname (void) const {\n";
+      print "          return vrpn_codec::array<$vartype>(d_$varname, d_${varname}_count);\n";
+      print "        }\n";
+    } elsif (codecIsArray($thisarg)) {
+      print "        vrpn_codec::array<$vartype> $varname (void) const {\n";
+      print "          return vrpn_codec::array<$vartype>(d_$varname, "
+          . codecCount($thisarg, $fieldarray) . ");\n";
+      print "        }\n";
+    } else {
+      print "        $vartype $varname (void) const {\n";
+      print "          return vrpn_codec::read<$vartype>(d_$varname);\n";
+      print "        }\n";
+    }
+  }
+  if ($#$fieldarray >= 0) {
+    print "\n      private:\n";
+    foreach $thisarg (@$fieldarray) {
+      print "        const char * d_" . @$thisarg[2] . ";\n";
+      if (codecIsVariable($thisarg)) {
+        print "        vrpn_uint32 d_" . @$thisarg[2] . "_count;\n";
+      }
+    }
+  }
+  print "    };\n";
+  print "  };\n\n";
+  1;
+}
+
+# Create the codec header for a message group.
+sub writeCodecFile (;$)
+{
+  if (defined($_[0])) {
+    $most_recent_tree = $_[0];
+  }
+  my $className = $most_recent_tree . "_Codec";
+  my $caps_class = $className;
+  $caps_class =~ tr/[a-z]/[A-Z]/;
+
+  # Warning: we are opening and selecting a new file for output. 
+  # Must go back to old file at end of function. 
+  my $filehandle = select();
+  open (CODECOUTF, ">" . $className . ".h") or
+      die "Can't open codec output file";
+  select(CODECOUTF);
+
+  print "#ifndef " . $caps_class . "_H\n";
+  print "#define " . $caps_class . "_H\n";
+  emitWriteWarning();
+  print "\n#include \"vrpn_BufferUtils.h\"\n\n";
+  emitAllDefines($most_recent_tree);
+  print "class $className {\n";
+  print "  public:\n\n";
+  foreach ( @{$msg_trees{$most_recent_tree}}) {
+    emitCodec($_);
+  }
+  print "};\n\n";
+  print "#endif // ${caps_class}_H\n";
+  close (CODECOUTF);
+
+  # Go back to old file now.
+  select($filehandle);
+  print STDOUT "Output " . $className . ".h codec file.\n";
+  1;
+}
+
 sub emitAllDefines(;$) 
 {
   if ($_[0]) {
@@ -1614,6 +1971,7 @@ $outputInput = "";
 $outputFileName = "";
 $base_c_flag = 0;
 $base_h_flag = 0;
+$codec_flag = 0;
 $msg_def_file = "";
 $spec_file = "";
 process_args();
@@ -1631,6 +1989,13 @@ if ($base_c_flag) {
   writeBaseClassFiles();
 }
 
+if ($codec_flag) {
+  # Create a codec header.
+  $headerFlag = 1;
+  parseMsgDefFile($msg_def_file);
+  writeCodecFile();
+}
+
 if ($spec_file) {
   $headerFlag = 0;
   open(FH, "< " . $spec_file);
@@ -1663,13 +2028,16 @@ sub process_args {
         } elsif ($a eq "-h") {
             $base_h_flag = 1;
             $msg_def_file = shift @myargv ;
+        } elsif ($a eq "-t") {
+            $codec_flag = 1;
+            $msg_def_file = shift @myargv ;
         } elsif ($a eq "-q") {
             $verbose = 0;
         } else {
             $spec_file = $a;
         }
     }
-    if (!$spec_file && !$base_c_flag && !$base_h_flag) {
+    if (!$spec_file && !$base_c_flag && !$base_h_flag && !$codec_flag) {
       print "No files specified, no output produced\n";
       Usage();
     }
@@ -1681,6 +2049,10 @@ sub process_args {
       print "Non-existent message definition file specified with -h option\n.";
       Usage();
     }
+    if ($codec_flag && !(-e $msg_def_file)) {
+      print "Non-existent message definition file specified with -t option\n.";
+      Usage();
+    }
     if ($spec_file && !(-e $spec_file)) {
       print "Non-existent input file specified \n.";
       Usage();
@@ -1695,6 +2067,7 @@ Usage: gen_vrpn_rpc <options>
  where options are: 
  -c <msg def file>       : Output a base class C file from a msg def file
  -h <msg def file>       : Output a base class header file from a msg def file
+ -t <msg def file>       : Output a header of message codecs from a msg def file
  <code file>             : file with vrpn_rpc directives to be translated
 
 Generally, specify only one of the options to output one file. 
@@ -0,0 +1,98 @@
+#ifndef VRPN_ANALOG_CODEC_H
+#define VRPN_ANALOG_CODEC_H
+//Warning: this file automatically generated using the command line
+// util/gen_rpc/gen_vrpn_rpc.pl -t vrpn_Analog.vrpndef
+//DO NOT EDIT! Edit the source file instead.
+
+#include "vrpn_BufferUtils.h"
+
+class vrpn_Analog_Codec {
+  public:
+
+  struct Channel {
+    vrpn_float64 num_channel;
+    vrpn_float64 * channel;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_float64>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size
+        + vrpn_codec::wire_size<vrpn_float64>::value * vrpn_codec::count(num_channel);
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_uint32 var_len = 0;
+      {
+        vrpn_uint32 n = vrpn_codec::count(num_channel);
+        if ((n && !channel) ||
+            (n > (buflen - fixed_size - var_len) / vrpn_codec::wire_size<vrpn_float64>::value)) return -1;
+        var_len += n * vrpn_codec::wire_size<vrpn_float64>::value;
+      }
+      vrpn_codec::put(&buf, num_channel);
+      vrpn_codec::put_array(&buf, channel, vrpn_codec::count(num_channel));
+      return static_cast<int>(fixed_size + var_len);
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Variable-length arrays are filled in where their pointers point,
+    // and each count may be no larger than its max_ value.
+    // Returns the number of bytes read, or -1 if the message is short
+    // or too large.
+    int decode (const char * buf, vrpn_uint32 buflen, vrpn_uint32 max_num_channel) {
+      if (buflen < fixed_size) return -1;
+      vrpn_uint32 var_len = 0;
+      vrpn_codec::get(&buf, &num_channel);
+      {
+        if (vrpn_codec::count(num_channel) > max_num_channel) return -1;
+        vrpn_uint32 n = vrpn_codec::count(num_channel);
+        if ((n && !channel) ||
+            (n > (buflen - fixed_size - var_len) / vrpn_codec::wire_size<vrpn_float64>::value)) return -1;
+        vrpn_codec::get_array(&buf, channel, n);
+        var_len += n * vrpn_codec::wire_size<vrpn_float64>::value;
+      }
+      return static_cast<int>(fixed_size + var_len);
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_num_channel(NULL), d_channel(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          vrpn_uint32 var_len = 0;
+          d_num_channel = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value;
+          d_channel = buf;
+          d_channel_count = vrpn_codec::count(vrpn_codec::read<vrpn_float64>(d_num_channel));
+          if (d_channel_count > (buflen - fixed_size - var_len) / vrpn_codec::wire_size<vrpn_float64>::value) return -1;
+          var_len += d_channel_count * vrpn_codec::wire_size<vrpn_float64>::value;
+          buf += d_channel_count * vrpn_codec::wire_size<vrpn_float64>::value;
+          return static_cast<int>(fixed_size + var_len);
+        }
+
+        vrpn_float64 num_channel (void) const {
+          return vrpn_codec::read<vrpn_float64>(d_num_channel);
+        }
+        vrpn_codec::array<vrpn_float64> channel (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_channel, d_channel_count);
+        }
+
+      private:
+        const char * d_num_channel;
+        const char * d_channel;
+        vrpn_uint32 d_channel_count;
+    };
+  };
+
+};
+
+#endif // VRPN_ANALOG_CODEC_H
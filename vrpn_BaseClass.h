@@ -69,7 +69,16 @@ const int vrpn_MAX_BCADRS =	100;
 typedef enum {vrpn_TEXT_NORMAL = 0, vrpn_TEXT_WARNING = 1, vrpn_TEXT_ERROR = 2} vrpn_TEXT_SEVERITY;
 const unsigned	vrpn_MAX_TEXT_LEN = 1024;
 
+/// Text messages from one object are rate-limited:  repeats of a message
+/// within a window of the time it was last sent are held back and sent as
+/// one message ending with the repeat count, and at most a budget of
+/// messages is sent per window.  These are the defaults, which can be
+/// changed for each object with set_text_message_coalescing().
+const double	vrpn_TEXT_COALESCE_WINDOW = 1.0;	///< Seconds
+const vrpn_uint32	vrpn_TEXT_COALESCE_BUDGET = 20;		///< Messages per window
+
 class	VRPN_API vrpn_BaseClass;
+struct	vrpn_Text_Coalescer;
 
 /// Class that handles text/warning/error printing for all objects in the
 /// system.
@@ -142,6 +151,10 @@ class VRPN_API vrpn_BaseClassUnique {
 
 	bool shutup;	// if True, don't print the "No response from server" messages.
 
+	/// Sets how text messages from this object are rate-limited (see
+	/// vrpn_TEXT_COALESCE_WINDOW).  A window of zero sends every message.
+	void set_text_message_coalescing(double window_seconds, vrpn_uint32 budget);
+
 	friend class SendTextMessageBoundCall;
 	class SendTextMessageBoundCall {
 		private:
@@ -226,6 +239,19 @@ class VRPN_API vrpn_BaseClassUnique {
       int	d_unanswered_ping;		///< Do we have an outstanding ping request?
       int	d_flatline;			///< Has it been 10+ seconds without a response?
 
+      double		d_text_window;		///< Seconds to coalesce text messages over
+      vrpn_uint32	d_text_budget;		///< Text messages to send per window
+      vrpn_Text_Coalescer	*d_text_coalescer;	///< Held-back text, made on first use
+
+      /// Packs one text message for sending, with its actual length.
+      int	pack_text_message(const char *msg, size_t len, struct timeval timestamp,
+			vrpn_TEXT_SEVERITY type, vrpn_uint32 level);
+      /// Sends the repeat counts of the held-back messages whose windows have
+      /// run out by now, or of all of them.
+      void	flush_text_messages(const struct timeval &now, bool all);
+      /// Sends one held-back message with its repeat count.
+      void	send_text_repeats(unsigned which, const struct timeval &now);
+
       /// Used by client/server code to request/send "server is alive" (pong) message
       static	int VRPN_CALLBACK handle_ping(void *userdata, vrpn_HANDLERPARAM p);
       static	int VRPN_CALLBACK handle_pong(void *userdata, vrpn_HANDLERPARAM p);
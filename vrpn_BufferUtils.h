@@ -128,8 +128,213 @@ namespace vrpn_byte_order {
 		outVal.asInt = ntoh(inVal.asInt);
 		return outVal.asInput;
 	}
+	namespace detail {
+		/// Reverses the bytes of a 16-bit uint
+		inline vrpn_uint16 swap_bytes(vrpn_uint16 val) {
+			return static_cast<vrpn_uint16>((val >> 8) | (val << 8));
+		}
+
+		/// Reverses the bytes of a 32-bit uint
+		inline vrpn_uint32 swap_bytes(vrpn_uint32 val) {
+#if defined(__GNUC__)
+			return __builtin_bswap32(val);
+#else
+			return (val >> 24) | ((val >> 8) & 0xff00) |
+				((val << 8) & 0xff0000) | (val << 24);
+#endif
+		}
+
+		/// Copies count values of the given size from src to dst, reversing
+		/// the bytes of each.  The loops are simple enough for the compiler
+		/// to turn into vector shuffles.
+		template<int TypeSize>
+		struct array_swapper;
+
+		template<> struct array_swapper<1> {
+			static void swap(char * dst, const char * src, vrpn_uint32 count) {
+				memcpy(dst, src, count);
+			}
+		};
+		template<> struct array_swapper<2> {
+			static void swap(char * dst, const char * src, vrpn_uint32 count) {
+				for (vrpn_uint32 i = 0; i < count; i++) {
+					vrpn_uint16 val;
+					memcpy(&val, src + 2 * i, 2);
+					val = swap_bytes(val);
+					memcpy(dst + 2 * i, &val, 2);
+				}
+			}
+		};
+		template<> struct array_swapper<4> {
+			static void swap(char * dst, const char * src, vrpn_uint32 count) {
+				for (vrpn_uint32 i = 0; i < count; i++) {
+					vrpn_uint32 val;
+					memcpy(&val, src + 4 * i, 4);
+					val = swap_bytes(val);
+					memcpy(dst + 4 * i, &val, 4);
+				}
+			}
+		};
+		template<> struct array_swapper<8> {
+			static void swap(char * dst, const char * src, vrpn_uint32 count) {
+				for (vrpn_uint32 i = 0; i < count; i++) {
+					vrpn_uint32 val[2], swapped[2];
+					memcpy(val, src + 8 * i, 8);
+					swapped[0] = swap_bytes(val[1]);
+					swapped[1] = swap_bytes(val[0]);
+					memcpy(dst + 8 * i, swapped, 8);
+				}
+			}
+		};
+	} // end of namespace detail
+
+	/// Copies count values of type T from src to dst, converting each between
+	/// host and network byte order (the conversion is its own inverse).
+	/// Neither buffer need be aligned, but they must not overlap.
+	template<typename T>
+	inline void convert_array(char * dst, const char * src, vrpn_uint32 count) {
+		if (vrpn_big_endian) {
+			memcpy(dst, src, count * sizeof(T));
+		} else {
+			detail::array_swapper<sizeof(T)>::swap(dst, src, count);
+		}
+	}
+
+	/// Copies count values of type T from src to dst, converting each between
+	/// host and little-endian byte order; some messages (imager regions) are
+	/// sent little-endian rather than in network order.  The conversion may
+	/// be done in place, with dst equal to src.
+	template<typename T>
+	inline void convert_little_endian_array(char * dst, const char * src, vrpn_uint32 count) {
+		if (vrpn_big_endian) {
+			detail::array_swapper<sizeof(T)>::swap(dst, src, count);
+		} else if (dst != src) {
+			memcpy(dst, src, count * sizeof(T));
+		}
+	}
+
+#if defined(__arm__) && !defined(__ANDROID__) && defined(__FLOAT_WORD_ORDER) && (__FLOAT_WORD_ORDER != __BYTE_ORDER)
+	/// Mixed-endian floating point: leave it to htond().
+	template<>
+	inline void convert_array<vrpn_float64>(char * dst, const char * src, vrpn_uint32 count) {
+		for (vrpn_uint32 i = 0; i < count; i++) {
+			vrpn_float64 val;
+			memcpy(&val, src + 8 * i, 8);
+			val = htond(val);
+			memcpy(dst + 8 * i, &val, 8);
+		}
+	}
+#endif
 } // end of namespace vrpn_byte_order
 
+/// @brief Support for the message codecs that util/gen_rpc/gen_vrpn_rpc.pl
+/// writes with its -t option (vrpn_Tracker_Codec.h and the like).  Callers
+/// check the buffer length once per message, so these do not.
+namespace vrpn_codec {
+	/// Bytes a value of type T takes on the wire.
+	template<typename T>
+	struct wire_size {
+		enum { value = sizeof(T) };
+	};
+
+	/// A timeval is sent as two 32-bit ints.
+	template<> struct wire_size<timeval> {
+		enum { value = 2 * sizeof(vrpn_int32) };
+	};
+
+	/// Number of elements given by a count field; a negative count means none.
+	template<typename T>
+	inline vrpn_uint32 count(T value) {
+		if (!(value > 0)) {
+			return 0;
+		}
+		if (static_cast<double>(value) >= 4294967295.0) {
+			return 0xffffffffu;
+		}
+		return static_cast<vrpn_uint32>(value);
+	}
+
+	/// Buffers count values in network byte order and advances the pointer.
+	template<typename T>
+	inline void put_array(char ** buf, const T * values, vrpn_uint32 count) {
+		vrpn_byte_order::convert_array<T>(*buf, reinterpret_cast<const char *>(values), count);
+		*buf += count * sizeof(T);
+	}
+
+	inline void put_array(char ** buf, const timeval * values, vrpn_uint32 count) {
+		for (vrpn_uint32 i = 0; i < count; i++) {
+			vrpn_int32 val[2];
+			val[0] = values[i].tv_sec;
+			val[1] = values[i].tv_usec;
+			put_array(buf, val, 2);
+		}
+	}
+
+	/// Buffers one value in network byte order and advances the pointer.
+	template<typename T>
+	inline void put(char ** buf, const T & value) {
+		put_array(buf, &value, 1);
+	}
+
+	/// Unbuffers count values into host byte order and advances the pointer.
+	template<typename T>
+	inline void get_array(const char ** buf, T * values, vrpn_uint32 count) {
+		vrpn_byte_order::convert_array<T>(reinterpret_cast<char *>(values), *buf, count);
+		*buf += count * sizeof(T);
+	}
+
+	inline void get_array(const char ** buf, timeval * values, vrpn_uint32 count) {
+		for (vrpn_uint32 i = 0; i < count; i++) {
+			vrpn_int32 val[2];
+			get_array(buf, val, 2);
+			values[i].tv_sec = val[0];
+			values[i].tv_usec = val[1];
+		}
+	}
+
+	/// Unbuffers one value into host byte order and advances the pointer.
+	template<typename T>
+	inline void get(const char ** buf, T * value) {
+		get_array(buf, value, 1);
+	}
+
+	/// Reads one value in place, without advancing.
+	template<typename T>
+	inline T read(const char * buf) {
+		T value;
+		get(&buf, &value);
+		return value;
+	}
+
+	/// An array in a received buffer, whose elements are converted into
+	/// host byte order as they are read.
+	template<typename T>
+	class array {
+	public:
+		array(const char * data, vrpn_uint32 count) : d_data(data), d_count(count) {}
+
+		/// Number of elements
+		vrpn_uint32 size() const { return d_count; }
+
+		/// The elements as they are on the wire
+		const char * data() const { return d_data; }
+
+		T operator[](vrpn_uint32 i) const {
+			return read<T>(d_data + i * wire_size<T>::value);
+		}
+
+		/// Converts all of the elements into dst at once.
+		void copy_to(T * dst) const {
+			const char * buf = d_data;
+			get_array(&buf, dst, d_count);
+		}
+
+	private:
+		const char * d_data;
+		vrpn_uint32 d_count;
+	};
+} // end of namespace vrpn_codec
+
 namespace detail {
 	template<typename T>
 	struct remove_const {
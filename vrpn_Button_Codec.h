@@ -0,0 +1,159 @@
+#ifndef VRPN_BUTTON_CODEC_H
+#define VRPN_BUTTON_CODEC_H
+//Warning: this file automatically generated using the command line
+// util/gen_rpc/gen_vrpn_rpc.pl -t vrpn_Button.vrpndef
+//DO NOT EDIT! Edit the source file instead.
+
+#include "vrpn_BufferUtils.h"
+
+class vrpn_Button_Codec {
+  public:
+
+  struct Change {
+    vrpn_int32 button;
+    vrpn_int32 state;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_int32>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, button);
+      vrpn_codec::put(&buf, state);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &button);
+      vrpn_codec::get(&buf, &state);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_button(NULL), d_state(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_button = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_state = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          return fixed_size;
+        }
+
+        vrpn_int32 button (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_button);
+        }
+        vrpn_int32 state (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_state);
+        }
+
+      private:
+        const char * d_button;
+        const char * d_state;
+    };
+  };
+
+  struct States {
+    vrpn_int32 num_buttons;
+    vrpn_int32 * states;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int32>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size
+        + vrpn_codec::wire_size<vrpn_int32>::value * vrpn_codec::count(num_buttons);
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_uint32 var_len = 0;
+      {
+        vrpn_uint32 n = vrpn_codec::count(num_buttons);
+        if ((n && !states) ||
+            (n > (buflen - fixed_size - var_len) / vrpn_codec::wire_size<vrpn_int32>::value)) return -1;
+        var_len += n * vrpn_codec::wire_size<vrpn_int32>::value;
+      }
+      vrpn_codec::put(&buf, num_buttons);
+      vrpn_codec::put_array(&buf, states, vrpn_codec::count(num_buttons));
+      return static_cast<int>(fixed_size + var_len);
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Variable-length arrays are filled in where their pointers point,
+    // and each count may be no larger than its max_ value.
+    // Returns the number of bytes read, or -1 if the message is short
+    // or too large.
+    int decode (const char * buf, vrpn_uint32 buflen, vrpn_uint32 max_num_buttons) {
+      if (buflen < fixed_size) return -1;
+      vrpn_uint32 var_len = 0;
+      vrpn_codec::get(&buf, &num_buttons);
+      {
+        if (vrpn_codec::count(num_buttons) > max_num_buttons) return -1;
+        vrpn_uint32 n = vrpn_codec::count(num_buttons);
+        if ((n && !states) ||
+            (n > (buflen - fixed_size - var_len) / vrpn_codec::wire_size<vrpn_int32>::value)) return -1;
+        vrpn_codec::get_array(&buf, states, n);
+        var_len += n * vrpn_codec::wire_size<vrpn_int32>::value;
+      }
+      return static_cast<int>(fixed_size + var_len);
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_num_buttons(NULL), d_states(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          vrpn_uint32 var_len = 0;
+          d_num_buttons = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_states = buf;
+          d_states_count = vrpn_codec::count(vrpn_codec::read<vrpn_int32>(d_num_buttons));
+          if (d_states_count > (buflen - fixed_size - var_len) / vrpn_codec::wire_size<vrpn_int32>::value) return -1;
+          var_len += d_states_count * vrpn_codec::wire_size<vrpn_int32>::value;
+          buf += d_states_count * vrpn_codec::wire_size<vrpn_int32>::value;
+          return static_cast<int>(fixed_size + var_len);
+        }
+
+        vrpn_int32 num_buttons (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_num_buttons);
+        }
+        vrpn_codec::array<vrpn_int32> states (void) const {
+          return vrpn_codec::array<vrpn_int32>(d_states, d_states_count);
+        }
+
+      private:
+        const char * d_num_buttons;
+        const char * d_states;
+        vrpn_uint32 d_states_count;
+    };
+  };
+
+};
+
+#endif // VRPN_BUTTON_CODEC_H
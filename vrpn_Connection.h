@@ -45,6 +45,10 @@ struct vrpn_HANDLERPARAM {
 typedef	int (VRPN_CALLBACK *vrpn_MESSAGEHANDLER)(void *userdata, vrpn_HANDLERPARAM p);
 /// Type of handler for filters on logfiles is the same as connection handler
 typedef	vrpn_MESSAGEHANDLER vrpn_LOGFILTER;
+/// Type of a relay on a connection is the same as connection handler, but
+/// it returns 1 if it took the message (so no callbacks should be made),
+/// 0 if the message should be dispatched normally and -1 on error.
+typedef	vrpn_MESSAGEHANDLER vrpn_MESSAGERELAY;
 
 /// VRPN buffers are aligned on 8 byte boundaries so that we can pack and
 // unpack doubles into them on architectures that cannot handle unaligned access.
@@ -83,6 +87,10 @@ const	int vrpn_CONNECTION_UDP_BUFLEN = 1472;
 
 const	int vrpn_MAX_ENDPOINTS = 256;
 
+/// Longest key that set_latest_value_type() will compare.
+
+const	int vrpn_CONNECTION_MAX_KEY_LEN = 8;
+
 // System message types
 
 const	vrpn_int32  vrpn_CONNECTION_SENDER_DESCRIPTION	= (-1);
@@ -103,6 +111,11 @@ const	vrpn_uint32 vrpn_CONNECTION_LOW_LATENCY		= (1<<2);
 const	vrpn_uint32 vrpn_CONNECTION_FIXED_THROUGHPUT	= (1<<3);
 const	vrpn_uint32 vrpn_CONNECTION_HIGH_THROUGHPUT	= (1<<4);
 
+// Not a class of service:  asks that the message not be packed to endpoints
+// that get a targeted sender standing in for the message's sender (see
+// vrpn_Connection::set_sender_targeted()).
+const	vrpn_uint32 vrpn_CONNECTION_REPLACEABLE		= (1<<5);
+
 // What to log
 const	long	vrpn_LOG_NONE		= (0);
 const	long	vrpn_LOG_INCOMING	= (1<<0);
@@ -163,6 +176,50 @@ class VRPN_API	vrpn_Connection;
 class VRPN_API	vrpn_Log;
 class VRPN_API	vrpn_TranslationTable;
 class VRPN_API	vrpn_TypeDispatcher;
+class VRPN_API	vrpn_UDPReceiveStatistics;
+
+/// Statistics gathered on the receiving side of an endpoint's unreliable
+/// (UDP) channel, based on the sequence number that the sender packs into
+/// every message header.  The sender numbers messages per channel, not per
+/// sender or type, so losses can only be counted for the channel as a whole.
+struct vrpn_UDPChannelStatistics {
+  vrpn_uint32	received;	///< Messages that arrived, including duplicates
+  vrpn_uint32	lost;		///< Sequence numbers that have not arrived
+  vrpn_uint32	duplicates;	///< Messages whose sequence number was seen
+  vrpn_uint32	out_of_order;	///< Messages older than the newest one seen
+  vrpn_uint32	highest_sequence;	///< Newest sequence number seen
+};
+
+/// Statistics for the messages of one (sender, type) pair arriving over an
+/// endpoint's UDP channel.  Sender and type are local IDs.  jitter_usec is
+/// the RFC 3550 interarrival jitter estimate computed from the message
+/// timestamps and the local arrival times.
+struct vrpn_UDPStreamStatistics {
+  vrpn_int32	sender;
+  vrpn_int32	type;
+  vrpn_uint32	received;	///< Messages that arrived, including duplicates
+  vrpn_uint32	duplicates;	///< Copies of a message already received
+  vrpn_uint32	out_of_order;	///< Older than one already received
+  vrpn_uint32	stale_dropped;	///< Duplicates or stale states not dispatched
+  vrpn_float64	jitter_usec;	///< Interarrival jitter in microseconds
+};
+
+/// Statistics for the TCP data that an endpoint is holding for a peer that
+/// has not taken it yet (see vrpn_Connection::set_tcp_queue_limit()).
+struct vrpn_TCPQueueStatistics {
+  vrpn_uint32	queued_bytes;	///< Bytes waiting to be sent
+  vrpn_uint32	queued_messages;	///< Messages not yet completely sent
+  vrpn_uint32	dropped_messages;	///< Superseded messages thrown away
+  vrpn_uint32	overflows;	///< Times the queue went over its limit
+  vrpn_uint32	replaced_messages;	///< State messages packed over older ones
+};
+
+// What an endpoint does when the queue grows past its limit.
+const	int vrpn_TCP_QUEUE_DROP_SUPERSEDED = 0;
+const	int vrpn_TCP_QUEUE_DISCONNECT = 1;
+
+struct vrpn_TCP_Chunk;
+struct vrpn_Queued_Message;
 
 // Encapsulation of the data and methods for a single generic connection
 // to take care of one part of many clients talking to a single server.
@@ -186,6 +243,17 @@ class VRPN_API vrpn_Endpoint {
     /// Returns the local mapping for the remote sender (-1 if none).
     int local_sender_id (vrpn_int32 remote_sender) const;
 
+    /// Returns whether the peer introduced the local sender, rather than
+    /// describing it back after hearing about it from this side.
+    vrpn_bool peer_has_sender (vrpn_int32 local_sender) const;
+
+    /// Counts changes to the senders the peer has described.
+    vrpn_uint32 peer_sender_changes (void) const;
+
+    /// Returns whether the endpoint gets the local sender's messages when
+    /// it is targeted:  if the peer introduced it or asked for it.
+    vrpn_bool gets_sender (vrpn_int32 local_sender) const;
+
     virtual vrpn_bool doing_okay (void) const = 0;
 
     // MANIPULATORS
@@ -210,7 +278,8 @@ class VRPN_API vrpn_Endpoint {
     int newRemoteType (cName type_name, vrpn_int32 remote_id,
                        vrpn_int32 local_id);
     int newRemoteSender (cName sender_name, vrpn_int32 remote_id,
-                         vrpn_int32 local_id);
+                         vrpn_int32 local_id,
+                         vrpn_bool introduced = VRPN_FALSE);
 
     // Pack a message that will be sent the next time mainloop() is called.
     // Turn off the RELIABLE flag if you want low-latency (UDP) send.
@@ -263,6 +332,17 @@ class VRPN_API vrpn_Endpoint {
     // for example.
     char rhostname [150];
 
+    // Which local senders this endpoint gets a targeted stand-in for,
+    // worked out by vrpn_Connection::find_stand_ins() and kept until the
+    // targeted senders or the peer's senders change.
+    unsigned char d_getsStandInFor [vrpn_CONNECTION_MAX_SENDERS];
+    vrpn_uint32 d_standInTargeting;	// Connection's targeting changes
+    vrpn_uint32 d_standInSenders;	// peer_sender_changes() for it
+
+    // Targeted senders that the peer asked for, through
+    // vrpn_Connection::send_sender_to_requester().
+    unsigned char d_requestedSenders [vrpn_CONNECTION_MAX_SENDERS];
+
     // Logging - TCH 19 April 00;  changed into two logs 16 Feb 01
 
     vrpn_Log * d_inLog;
@@ -359,9 +439,33 @@ class VRPN_API vrpn_Endpoint_IP : public vrpn_Endpoint {
 
     int pack_udp_description (int portno);
 
+    int get_udp_channel_statistics (vrpn_UDPChannelStatistics * stats) const;
+    int get_udp_stream_statistics (vrpn_int32 sender, vrpn_int32 type,
+                                   vrpn_UDPStreamStatistics * stats) const;
+      ///< Copy out the receive statistics for the UDP channel or for one
+      ///< (local sender, local type) stream on it.  Return 0 on success,
+      ///< -1 if there is nothing recorded for the stream.
+    void reset_udp_statistics (void);
+
+    int get_tcp_queue_statistics (vrpn_TCPQueueStatistics * stats) const;
+    int flush_tcp_queue (const timeval & deadline);
+      ///< Waits until the peer has taken all the TCP data queued for it,
+      ///< or until deadline.  Returns 0 if it all went, -1 otherwise.
+
     int handle_tcp_messages (const timeval * timeout);
     int handle_udp_messages (const timeval * timeout);
 
+    // When the connection receives on its own thread, that thread calls
+    // receive_udp_datagrams() to read whatever datagrams are waiting onto
+    // d_udpQueue, and mainloop() calls handle_queued_udp_messages() to
+    // parse and dispatch them.  Both return -1 on failure, or else the
+    // number of datagrams read or messages handled.
+    SOCKET udp_inbound_socket (void) const { return d_udpInboundSocket; }
+    vrpn_bool udp_receive_failed (void) const { return d_udpReceiveFailed; }
+    int receive_udp_datagrams (void);
+    int handle_queued_udp_messages (void);
+    void clear_udp_queue (void);
+
     int connect_tcp_to (const char * msg);
     int connect_tcp_to (const char * addr, int port);
       ///< Connects d_tcpSocket to the specified address (msg = "IP port");
@@ -420,7 +524,9 @@ class VRPN_API vrpn_Endpoint_IP : public vrpn_Endpoint {
   protected:
 
     int getOneTCPMessage (int fd, char * buf, int buflen);
-    int getOneUDPMessage (char * buf, int buflen);
+    int getOneUDPMessage (char * buf, int buflen,
+                          vrpn_bool superseded = vrpn_FALSE);
+      ///< A superseded message is logged and counted but not dispatched.
 
     SOCKET d_udpOutboundSocket;
     SOCKET d_udpInboundSocket;
@@ -448,6 +554,67 @@ class VRPN_API vrpn_Endpoint_IP : public vrpn_Endpoint {
     char * d_udpInbuf;
 
     char * d_NICaddress;
+
+    vrpn_UDPReceiveStatistics * d_udpStatistics;
+      ///< Loss, reordering and jitter accounting for the inbound UDP
+      ///< channel, fed by the sequence number in each message header.
+    timeval d_udpArrivalTime;
+      ///< Time at which the datagram being parsed was received.
+
+    // TCP data the peer has not taken yet, oldest first, in chunks that
+    // each hold whole messages.  Chunks that have been sent are kept on
+    // d_tcpFreeChunks (up to a few) to be used again.
+    vrpn_TCP_Chunk * d_tcpQueueHead;
+    vrpn_TCP_Chunk * d_tcpQueueTail;
+    vrpn_TCP_Chunk * d_tcpFreeChunks;
+    vrpn_int32 d_tcpNumFreeChunks;
+    vrpn_uint32 d_tcpQueuedBytes;
+    vrpn_uint32 d_tcpDroppedMessages;
+    vrpn_uint32 d_tcpOverflows;
+
+    int queue_tcp_data (const char * buf, vrpn_int32 len, vrpn_int32 sent);
+      ///< Queues the whole messages in buf, the first sent bytes of which
+      ///< have gone already.  Returns 0 on success, -1 on failure.
+    int send_tcp_queue (void);
+      ///< Sends as much of the queue as the socket will take without
+      ///< waiting.  Returns 0 on success, -1 on failure.
+    int trim_tcp_queue (void);
+      ///< Applies the connection's policy once the queue is over its
+      ///< limit.  Returns -1 if the connection should be dropped.
+    void clear_tcp_queue (void);
+
+    // When the connection coalesces state messages, where the newest
+    // unsent message of each state type, sender and key is, in an
+    // open-addressed hash table.  Sending or trimming moves messages, so
+    // it is marked stale then and built again from the queue and
+    // d_tcpOutbuf when it is next wanted.
+    vrpn_Queued_Message * d_queuedState;
+    vrpn_uint32 d_queuedStateSize;
+    vrpn_uint32 d_numQueuedState;
+    vrpn_bool d_queuedStateStale;
+    vrpn_uint32 d_tcpReplacedMessages;
+    vrpn_bool d_tcpLowWater;
+      ///< Whether d_tcpSocket has been asked to hold little unsent data.
+
+    int replace_queued_state (vrpn_uint32 len, timeval time,
+                              vrpn_int32 type, vrpn_int32 sender,
+                              const char * buffer);
+      ///< Packs the message over the newest unsent one of the same type
+      ///< and sender with the same key, if there is one of the same
+      ///< length.  Returns 1 if it did, 0 if not, -1 on failure.
+    int note_queued_state (const char * start, vrpn_uint32 len);
+      ///< Adds the message at start, if it carries state, to d_queuedState.
+      ///< Returns 0 on success, -1 on failure.
+    int index_queued_state (void);
+      ///< Builds d_queuedState again.  Returns 0 on success, -1 on failure.
+
+    vrpn_MPSC_Queue d_udpQueue;
+      ///< Datagrams read by the receive thread, waiting for mainloop().
+    vrpn_bool d_udpReceiveFailed;
+      ///< Set by the receive thread when it can't read the UDP socket.
+    vrpn_float64 d_udpThreadAlignedInbuf
+         [vrpn_CONNECTION_UDP_BUFLEN / sizeof(vrpn_float64) + 1];
+      ///< Where the receive thread reads each datagram.
 };
 
 // Generic connection class not specific to the transport mechanism.
@@ -483,6 +650,10 @@ class VRPN_API vrpn_Connection {
     virtual vrpn_bool doing_okay (void) const;
     virtual vrpn_bool connected (void) const;
 
+    // Returns true if this is a server's connection, listening for
+    // clients, rather than a client's connection to a server.
+    vrpn_bool is_server (void) const;
+
     // This function returns the logfile names of this connection in
     // the parameters.  It will allocate memory for the name of each 
     // log file in use.  If no logging of a particular type is happening, 
@@ -555,6 +726,33 @@ class VRPN_API vrpn_Connection {
     // Save any messages on any endpoints which have been logged so far.
     virtual int save_log_so_far();
 
+    // Sets up (or removes) a relay for user messages that arrive from the
+    // network.  Relays are called before any handlers, with the local type
+    // and sender IDs and the payload still in the endpoint's receive buffer.
+    // A relay that returns 1 has taken the message, and no handlers are
+    // called for it.  This is used by forwarders that move messages from
+    // one connection to another without decoding them.
+    // Returns nonzero on failure.
+    virtual int register_relay (vrpn_MESSAGERELAY relay, void * userdata);
+    virtual int unregister_relay (vrpn_MESSAGERELAY relay, void * userdata);
+
+    // Called by endpoints for each incoming user message.  Returns 1 if
+    // a relay took the message, 0 if not and -1 on error.
+    int do_relays_for (vrpn_int32 type, vrpn_int32 sender,
+                       struct timeval time, vrpn_uint32 len,
+                       const char * buffer) {
+      return d_relays ? call_relays(type, sender, time, len, buffer) : 0;
+    };
+
+    // Called by endpoints around the handlers for each incoming user
+    // message, so that a handler can tell which peer sent it.  Returns
+    // the endpoint that was set before.
+    vrpn_Endpoint * set_dispatching_endpoint (vrpn_Endpoint * endpoint) {
+      vrpn_Endpoint * was = d_dispatchingEndpoint;
+      d_dispatchingEndpoint = endpoint;
+      return was;
+    };
+
     // vrpn_File_Connection implements this as "return this" so it
     // can be used to detect a File_Connection and get the pointer for it
     virtual vrpn_File_Connection * get_File_Connection (void);
@@ -584,8 +782,162 @@ class VRPN_API vrpn_Connection {
     };
     vrpn_uint32 get_Jane_value(void) { return d_stop_processing_messages_after; };
 
+    // Each message sent over UDP carries a sequence number in its header.
+    // Endpoints use it to count lost, duplicated and reordered messages
+    // on their inbound UDP channel and to estimate the jitter of each
+    // (sender, type) stream.  When stale dropping is turned on, duplicate
+    // messages are thrown away rather than dispatched, and so is a message
+    // of a type given to set_latest_value_type() that is older than one
+    // already delivered from the same sender with the same key, so that
+    // callbacks never go back in time (for example, to an older pose of
+    // the same sensor).  Other out-of-order messages are still delivered.
+    // The statistics calls return -1 if the endpoint or stream is unknown.
+    // whichEndpoint is 0 for a client connection.
+    void set_drop_stale_udp_messages (vrpn_bool drop) {
+      d_drop_stale_udp_messages = drop;
+    };
+    vrpn_bool get_drop_stale_udp_messages (void) const {
+      return d_drop_stale_udp_messages;
+    };
+    int get_udp_channel_statistics (vrpn_UDPChannelStatistics * stats,
+                                    int whichEndpoint = 0) const;
+    int get_udp_stream_statistics (vrpn_int32 sender, vrpn_int32 type,
+                                   vrpn_UDPStreamStatistics * stats,
+                                   int whichEndpoint = 0) const;
+    void reset_udp_statistics (void);
+
+    // A client that can't call mainloop() often enough (because it is
+    // rendering, or waiting on something else) loses UDP messages whenever
+    // the socket's receive buffer fills between calls.  After
+    // start_receive_thread(), a thread reads UDP datagrams as they arrive
+    // and queues them, and mainloop() dispatches whatever has queued up;
+    // callbacks are still only ever called from mainloop(), and TCP is
+    // still read there.  Messages of a type given to set_latest_value_type()
+    // are coalesced within each batch:  of those from the same sender whose
+    // payloads start with the same key_len bytes (a sensor or channel
+    // number, say), only the last is handed to the callbacks, though all
+    // are logged and counted.  A key_len of 0 keeps only the last message
+    // of the type from each sender, -1 turns coalescing off, and more than
+    // vrpn_CONNECTION_MAX_KEY_LEN is an error (-1 return).
+    // start_receive_thread() returns false if the connection can't receive
+    // on a thread.
+    virtual bool start_receive_thread (void) { return false; };
+    virtual void stop_receive_thread (void) { };
+    virtual vrpn_bool receiving_on_thread (void) const { return vrpn_FALSE; };
+    int set_latest_value_type (vrpn_int32 type, vrpn_int32 key_len);
+    vrpn_int32 latest_value_key_len (vrpn_int32 local_type) const;
+
+    // When a peer doesn't read its TCP data as fast as it is sent, the
+    // endpoint queues whatever the socket won't take rather than waiting,
+    // so that one slow client doesn't hold up the others.  Once more than
+    // max_bytes are queued for a peer, vrpn_TCP_QUEUE_DROP_SUPERSEDED
+    // throws away the queued messages that a newer queued one makes stale
+    // (by the same rule as set_latest_value_type() uses), and drops the
+    // connection only if that does not bring it under the limit;
+    // vrpn_TCP_QUEUE_DISCONNECT drops the connection straight away.
+    // A max_bytes of 0 means no limit, which is the default, so that no
+    // reliable message is lost unless a connection asks for a limit.
+    // A connection that is destroyed waits up to a second for its peers
+    // to take what is queued for them; what they have not taken is lost.
+    // get_tcp_queue_statistics() returns -1 if the endpoint is unknown.
+    void set_tcp_queue_limit (vrpn_uint32 max_bytes,
+                        int policy = vrpn_TCP_QUEUE_DROP_SUPERSEDED) {
+      d_tcpQueueLimit = max_bytes;
+      d_tcpQueuePolicy = policy;
+    };
+    vrpn_uint32 get_tcp_queue_limit (void) const { return d_tcpQueueLimit; };
+    int get_tcp_queue_policy (void) const { return d_tcpQueuePolicy; };
+    int get_tcp_queue_statistics (vrpn_TCPQueueStatistics * stats,
+                                  int whichEndpoint = 0) const;
+
+    // Even when the queue is under its limit, a peer that reads more
+    // slowly than reports are made gets every stale one in order, so what
+    // it sees falls further and further behind.  With coalescing on, a
+    // message of a type given to set_latest_value_type() that is packed
+    // for TCP while an older one from the same sender with the same key
+    // has not started to go out is packed over that one instead (when they
+    // are the same length), so a peer has at most one unsent report of
+    // each state waiting.  Messages of other types, such as button presses
+    // and text, are never replaced.  So that stale reports wait where they
+    // can still be replaced, endpoints also ask their sockets to hold
+    // little unsent data, where the system allows it (TCP_NOTSENT_LOWAT).
+    // This is off by default, since a peer no longer gets every report.
+    void set_coalesce_state_messages (vrpn_bool coalesce) {
+      d_coalesceStateMessages = coalesce;
+    };
+    vrpn_bool get_coalesce_state_messages (void) const {
+      return d_coalesceStateMessages;
+    };
+
+    // Normally every message is packed to every endpoint.  Messages from
+    // a targeted sender are only packed to endpoints whose peer has
+    // registered a sender of the same name, so a server can send data that
+    // one client asked for to just that client.  A targeted sender can
+    // stand in for another sender:  messages from that sender that are
+    // packed with vrpn_CONNECTION_REPLACEABLE then skip the endpoints that
+    // get the stand-in.  has_sender_peer() tells whether any connected
+    // endpoint would get a targeted sender's messages.
+    // set_sender_targeted() returns nonzero on failure.
+    int set_sender_targeted (vrpn_int32 sender, vrpn_bool targeted,
+                             vrpn_int32 stands_in_for = -1);
+    vrpn_bool has_sender_peer (vrpn_int32 sender) const;
+
+    // Called from the handler for a message that came from a peer, this
+    // has a targeted sender's messages packed to that peer as well, until
+    // it drops.  A server can then answer a request with messages that
+    // only the client that asked gets, from a sender of its own that no
+    // client introduces.  Returns nonzero if no message from a peer is
+    // being handled.
+    int send_sender_to_requester (vrpn_int32 sender);
+
+    // Whether the sender was first named by a peer rather than here.  A
+    // peer can only introduce such a sender;  its descriptions of any
+    // other are echoes of ours.
+    vrpn_bool sender_from_peer (vrpn_int32 sender) const;
+    void set_sender_from_peer (vrpn_int32 sender);
+
   protected:
 
+    // Targeted senders, with the sender each stands in for (-1 if none).
+    vrpn_int32 d_targetedSenders [vrpn_CONNECTION_MAX_SENDERS];
+    vrpn_int32 d_standsInFor [vrpn_CONNECTION_MAX_SENDERS];
+    vrpn_int32 d_numTargetedSenders;
+
+    // For each sender, whether it is targeted and whether it is stood in
+    // for, so that most messages need no further checking.  The count
+    // goes up whenever these change.
+    unsigned char d_senderTargeting [vrpn_CONNECTION_MAX_SENDERS];
+    vrpn_uint32 d_targetingChanges;
+
+    // Whether a message from the sender should be packed to the endpoint.
+    vrpn_bool endpoint_wants (vrpn_Endpoint * endpoint,
+                              vrpn_int32 sender,
+                              vrpn_uint32 class_of_service);
+
+    // Works out which senders the endpoint gets a stand-in for.
+    void find_stand_ins (vrpn_Endpoint * endpoint);
+
+    unsigned char d_senderFromPeer [vrpn_CONNECTION_MAX_SENDERS];
+
+    // The endpoint whose message is being handled, if any.
+    vrpn_Endpoint * d_dispatchingEndpoint;
+
+    // Whether endpoints throw away stale UDP messages rather than
+    // dispatching them.
+    vrpn_bool d_drop_stale_udp_messages;
+
+    // Key length for each local type whose messages are coalesced when
+    // received on a thread, or -1.
+    vrpn_int32 d_latestValueKeyLen [vrpn_CONNECTION_MAX_TYPES];
+
+    // How much TCP data may be queued for a slow peer, and what to do
+    // when there is more.
+    vrpn_uint32 d_tcpQueueLimit;
+    int d_tcpQueuePolicy;
+
+    // Whether endpoints pack newer state messages over unsent older ones.
+    vrpn_bool d_coalesceStateMessages;
+
     // If this value is greater than zero, the connection should stop
     // looking for new messages on a given endpoint after this many
     // are found.
@@ -635,6 +987,12 @@ class VRPN_API vrpn_Connection {
     // Returns message type ID, or -1 if unregistered
     int message_type_is_registered (const char *) const;
 
+    // Relays registered with register_relay(), called in order.
+    vrpnMsgCallbackEntry * d_relays;
+    int call_relays (vrpn_int32 type, vrpn_int32 sender,
+                     struct timeval time, vrpn_uint32 len,
+                     const char * buffer);
+
     // Timekeeping - TCH 30 June 98
     timeval start_time;
 
@@ -755,6 +1113,10 @@ class VRPN_API vrpn_Connection_IP : public vrpn_Connection {
     // and this timeout will be divided evenly between them.
     virtual int mainloop (const struct timeval * timeout = NULL);
 
+    virtual bool start_receive_thread (void);
+    virtual void stop_receive_thread (void);
+    virtual vrpn_bool receiving_on_thread (void) const;
+
   protected:
 
     // If this value is greater than zero, the connection should stop
@@ -805,6 +1167,16 @@ class VRPN_API vrpn_Connection_IP : public vrpn_Connection {
     virtual void drop_connection (int whichEndpoint);
 
     char * d_NIC_IP;
+
+    // The thread that reads UDP while the application is busy.  It holds
+    // d_receiveLock while it touches the endpoints, and mainloop() holds
+    // it while handlers run or the endpoints might change.
+    vrpn_Thread * d_receiveThread;
+    vrpn_Semaphore d_receiveLock;
+    vrpn_bool d_receiveStop;      ///< Set under the lock to stop the thread
+    static void receive_thread_func (vrpn_ThreadData & threadData);
+    void receive_loop (void);
+    void wait_for_tcp (const struct timeval * timeout);
 };
 
 // Create a client connection of arbitrary type (VRPN UDP/TCP, TCP,
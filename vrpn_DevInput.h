@@ -34,6 +34,8 @@
 
 #ifdef VRPN_USE_DEV_INPUT
 
+struct input_event;
+
 class VRPN_API vrpn_DevInput :
 	public vrpn_Analog,
 	public vrpn_Button_Filter
@@ -47,10 +49,19 @@ public:
     virtual void mainloop();
 
 protected:  // methods
-    /// Try to read reports from the device.
-    /// Returns 1 if msg received, or 0 if none received.
+    /// Read all of the events waiting on the device, sending a report for
+    /// each frame of them that the device has finished.
+    /// Returns 1 if a frame was reported, or 0 if none was.
     virtual int get_report();
 
+    /// Handle one event from the device.  Returns true if it finished a
+    /// frame, which has been reported.
+    bool handle_event( const struct input_event &event );
+
+    /// Read the state of the buttons and absolute axes from the device,
+    /// after the kernel has dropped some of its events.
+    void resync();
+
     /// send report iff changed
     virtual void report_changes( vrpn_uint32 class_of_service
 		    = vrpn_CONNECTION_LOW_LATENCY );
@@ -71,6 +82,9 @@ private:  // disable unwanted default methods
     int d_fileDescriptor;
     vrpn_float64 d_absolute_min;
     vrpn_float64 d_absolute_range;
+    struct input_event *d_events;	///< Events read from the device, reused for each read
+    bool d_moved;			///< Relative motion in the frame so far
+    bool d_dropping;			///< Events were dropped: skip to the end of the frame
 };
 
 #endif
@@ -30,6 +30,7 @@ namespace vrpn_Event {
 
   // open the specified event interface
   // return a valid handle to the event interface or -1 if the open fails
+  // reads from the handle do not wait for events to arrive
   // file - full path of the event interface file 
   int vrpn_open_event( const char* file);
 
@@ -38,7 +39,8 @@ namespace vrpn_Event {
   void vrpn_close_event( const int fd);
 
   // read from the interface
-  // returns the number of bytes read successfully
+  // returns the number of events read successfully, 0 if none were waiting,
+  // or -1 if the read failed
   // fd - handle for the event interface
   // data - handle to the read data
   // max_elements - maximum number of elements to read
@@ -36,7 +36,7 @@ public:
 
 protected:
 
-  // read available events
+  // read all available events into event_data
   // returns number of structs read successfully
   int read_available_data();
 
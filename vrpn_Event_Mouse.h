@@ -43,12 +43,18 @@ private:
   //  This routine interpret data from the device
   void process_mouse_data ();
 
+  // send the reports for a frame of events the device has finished
+  void report_frame( const struct timeval &time);
+
   // set all buttons and analogs to 0
   void clear_values();
 
 private:
 
   struct timeval timestamp;       
+
+  // the frame so far has moved the mouse
+  bool moved;
 };
 
 #endif // _VRPN_EVENT_MOUSE_H_
@@ -6,6 +6,10 @@
 
 #define MAXPLANE 4   //maximum number of planes in the scene 
 
+// Largest payload of a trimesh block or vertex-range message.  Big meshes
+// are sent as several of these so that each fits into one TCP buffer.
+#define vrpn_FORCEDEVICE_MAX_BLOCK_LEN (vrpn_CONNECTION_TCP_BUFLEN - 128)
+
 // for recovery:
 #define DEFAULT_NUM_REC_CYCLES	(10)
 
@@ -144,6 +148,8 @@ class VRPN_API vrpn_ForceDevice : public vrpn_BaseClass {
     vrpn_int32 transformTrimesh_message_id;    
     vrpn_int32 setTrimeshType_message_id;    
     vrpn_int32 clearTrimesh_message_id;    
+    vrpn_int32 setTrimeshBlock_message_id;	// Many vertices and triangles
+    vrpn_int32 setVertexRanges_message_id;	// Vertices that changed
 
 	// IDs for scene messages
 	vrpn_int32 setHapticOrigin_message_id;
@@ -196,6 +202,16 @@ class VRPN_API vrpn_ForceDevice : public vrpn_BaseClass {
 	static char *encode_objectScale(vrpn_int32 &len,const vrpn_int32 objNum, const vrpn_float32 Scale[3]);
 	static char *encode_removeObject(vrpn_int32 &len,const vrpn_int32 objNum);
 	static char *encode_clearTrimesh(vrpn_int32 &len,const vrpn_int32 objNum);
+	// verts holds numVerts x,y,z triples and tris numTris vertex triples,
+	// the first being vertex firstVert and triangle firstTri.
+	static char *encode_trimeshBlock(vrpn_int32 &len,const vrpn_int32 objNum,
+		const vrpn_int32 firstVert, const vrpn_int32 numVerts, const vrpn_float32 *verts,
+		const vrpn_int32 firstTri, const vrpn_int32 numTris, const vrpn_int32 *tris);
+	// Range i is count[i] vertices starting at first[i];  their x,y,z
+	// triples are taken from verts, which holds the whole vertex array.
+	static char *encode_vertexRanges(vrpn_int32 &len,const vrpn_int32 objNum,
+		const vrpn_int32 numRanges, const vrpn_int32 *first, const vrpn_int32 *count,
+		const vrpn_float32 *verts);
 	static char *encode_moveToParent(vrpn_int32 &len,const vrpn_int32 objNum, const vrpn_int32 parentNum);
 	
 	static char *encode_setHapticOrigin(vrpn_int32 &len,const vrpn_float32 Pos[3], const vrpn_float32 axis[3], const vrpn_float32 angle);
@@ -253,6 +269,13 @@ class VRPN_API vrpn_ForceDevice : public vrpn_BaseClass {
 	static vrpn_int32 decode_objectScale(const char *buffer,vrpn_int32 len,vrpn_int32 *objNum, vrpn_float32 Scale[3]);
 	static vrpn_int32 decode_removeObject(const char *buffer,vrpn_int32 len,vrpn_int32 *objNum);
 	static vrpn_int32 decode_clearTrimesh(const char *buffer,vrpn_int32 len,vrpn_int32 *objNum);
+	// The arrays are filled in packed, and must each hold at least
+	// vrpn_FORCEDEVICE_MAX_BLOCK_LEN/sizeof(vrpn_int32) values.
+	static vrpn_int32 decode_trimeshBlock(const char *buffer,vrpn_int32 len,vrpn_int32 *objNum,
+		vrpn_int32 *firstVert, vrpn_int32 *numVerts, vrpn_float32 *verts,
+		vrpn_int32 *firstTri, vrpn_int32 *numTris, vrpn_int32 *tris);
+	static vrpn_int32 decode_vertexRanges(const char *buffer,vrpn_int32 len,vrpn_int32 *objNum,
+		vrpn_int32 *numRanges, vrpn_int32 *first, vrpn_int32 *count, vrpn_float32 *verts);
 	static vrpn_int32 decode_moveToParent(const char *buffer,vrpn_int32 len,vrpn_int32 *objNum, vrpn_int32 *parentNum);
 	
 	static vrpn_int32 decode_setHapticOrigin(const char *buffer,vrpn_int32 len,vrpn_float32 Pos[3],vrpn_float32 axis[3], vrpn_float32 *angle);
@@ -437,6 +460,11 @@ public:
     // set the trimesh's homogen transform matrix (in row major order)
     void setTrimeshTransform(vrpn_float32 homMatrix[16]);
     void clearTrimesh(void);
+    // bulk versions of setVertex() and setTriangle(); see setObjectTrimesh()
+    void setTrimesh(vrpn_int32 numVerts, const vrpn_float32 *verts,
+		  vrpn_int32 numTris, const vrpn_int32 *tris);
+    void updateVertices(vrpn_int32 numVerts, const vrpn_float32 *verts,
+		  const vrpn_float32 *previous = NULL);
   
 	/** functions for multiple objects in the haptic scene *************************************/
 	// Add an object to the haptic scene as root (parent -1 = default) or as child (ParentNum =the number of the parent)
@@ -465,6 +493,16 @@ public:
 	// remove an object from the scene
 	void removeObject(vrpn_int32 objNum);
     void clearObjectTrimesh(vrpn_int32 objNum);
+    // Sets vertices 0..numVerts-1 from the x,y,z triples in verts and
+    // triangles 0..numTris-1 from the vertex-index triples in tris, packed
+    // into as few messages as will fit.  Call updateObjectTrimeshChanges()
+    // afterwards, as with setObjectVertex().
+    void setObjectTrimesh(vrpn_int32 objNum, vrpn_int32 numVerts, const vrpn_float32 *verts,
+		  vrpn_int32 numTris, const vrpn_int32 *tris);
+    // For deforming meshes: sends only the vertices that differ between
+    // verts and previous (all of them if previous is NULL), as ranges.
+    void updateObjectVertices(vrpn_int32 objNum, vrpn_int32 numVerts,
+		  const vrpn_float32 *verts, const vrpn_float32 *previous = NULL);
   
 	/** Functions to organize the scene	**********************************************************/
 	// Change The parent of an object
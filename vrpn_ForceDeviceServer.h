@@ -65,6 +65,10 @@ protected:
 				     vrpn_HANDLERPARAM p);
 	static int VRPN_CALLBACK handle_clearTrimesh_message(void *userdata, 
 					 vrpn_HANDLERPARAM p);
+	static int VRPN_CALLBACK handle_setTrimeshBlock_message(void *userdata, 
+					 vrpn_HANDLERPARAM p);
+	static int VRPN_CALLBACK handle_setVertexRanges_message(void *userdata, 
+					 vrpn_HANDLERPARAM p);
 	// Add an object to the haptic scene as root (parent -1 = default) or as child (ParentNum =the number of the parent)
 	virtual bool addObject(vrpn_int32 objNum, vrpn_int32 ParentNum=-1)=0; 
 	// Add an object next to the haptic scene as root 
@@ -77,6 +81,13 @@ protected:
     virtual bool setTriangle(vrpn_int32 objNum, vrpn_int32 triNum,vrpn_int32 vert0,vrpn_int32 vert1,vrpn_int32 vert2,
 		  vrpn_int32 norm0=-1,vrpn_int32 norm1=-1,vrpn_int32 norm2=-1)=0;
     virtual bool removeTriangle(vrpn_int32 objNum, vrpn_int32 triNum)=0; 
+	// Set numVerts vertices from x,y,z triples, or numTris triangles from
+	// vertex-index triples, starting at firstVert or firstTri.  By default
+	// these call setVertex() and setTriangle() for each one.
+	virtual bool setVertices(vrpn_int32 objNum, vrpn_int32 firstVert, vrpn_int32 numVerts,
+		  const vrpn_float32 *verts);
+	virtual bool setTriangles(vrpn_int32 objNum, vrpn_int32 firstTri, vrpn_int32 numTris,
+		  const vrpn_int32 *tris);
     // should be called to incorporate the above changes into the 
     // displayed trimesh 
     virtual bool updateTrimeshChanges(vrpn_int32 objNum,vrpn_float32 kspring, vrpn_float32 kdamp, vrpn_float32 fdyn, vrpn_float32 fstat)=0;
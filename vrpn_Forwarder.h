@@ -20,6 +20,17 @@
 //     We allow users to take in a message of one name and send it out
 //     with another name;  this is useful and dangerous.
 
+//   Relay mode:
+//     By default a forwarder is an ordinary message handler on the source
+//     connection and flushes the destination after every message.  In
+//     relay mode it is instead registered as a relay on the source, so
+//     messages arriving from the network are copied straight from the
+//     receive buffer into the destination's outgoing buffers without being
+//     handed to any callbacks on the source, the type and sender mapping
+//     is a table lookup, and the destination is flushed by its own
+//     mainloop().  Messages packed locally on the source connection still
+//     go through the handler.
+
 // Faults:
 //   There is currently no way to specify vrpn_SENDER_ANY as a source.
 // If we do, it isn't clear what sender to specify to the destination.
@@ -55,9 +66,15 @@ class VRPN_API vrpn_ConnectionForwarder {
                    const char * destinationServiceName,
                    vrpn_uint32 classOfService = vrpn_CONNECTION_RELIABLE);
 
+    // Turns relay mode (see above) on or off.
+    // Return nonzero on failure.
+    int set_relay_mode (vrpn_bool relay);
+    vrpn_bool relay_mode (void) const { return d_relaying; }
+
   private:
 
     static int VRPN_CALLBACK handle_message (void *, vrpn_HANDLERPARAM);
+    static int VRPN_CALLBACK relay_message (void *, vrpn_HANDLERPARAM);
 
     // Translates (id, serviceId) from source to destination
     // and looks up intended class of service.
@@ -80,10 +97,19 @@ class VRPN_API vrpn_ConnectionForwarder {
       vrpn_uint32 classOfService;  // class of service to send
 
       vrpn_CONNECTIONFORWARDERRECORD * next;
+      vrpn_CONNECTIONFORWARDERRECORD * nextSameType;  // in d_relayTable
     };
 
     vrpn_CONNECTIONFORWARDERRECORD * d_list;
 
+    // Rebuilds d_relayTable from d_list.  Returns nonzero on failure.
+    int build_relay_table (void);
+
+    // Records indexed by source type id, chained through nextSameType.
+    vrpn_CONNECTIONFORWARDERRECORD ** d_relayTable;
+    vrpn_int32 d_relayTableSize;
+    vrpn_bool d_relaying;
+
 };
 
 class VRPN_API vrpn_StreamForwarder {
@@ -114,9 +140,15 @@ class VRPN_API vrpn_StreamForwarder {
                    const char * destinationName,
                    vrpn_uint32 classOfService = vrpn_CONNECTION_RELIABLE);
 
+    // Turns relay mode (see above) on or off.
+    // Return nonzero on failure.
+    int set_relay_mode (vrpn_bool relay);
+    vrpn_bool relay_mode (void) const { return d_relaying; }
+
   private:
 
     static int VRPN_CALLBACK handle_message (void *, vrpn_HANDLERPARAM);
+    static int VRPN_CALLBACK relay_message (void *, vrpn_HANDLERPARAM);
 
     // Translates (id, serviceId) from source to destination
     // and looks up intended class of service.
@@ -142,6 +174,14 @@ class VRPN_API vrpn_StreamForwarder {
 
     vrpn_STREAMFORWARDERRECORD * d_list;
 
+    // Rebuilds d_relayTable from d_list.  Returns nonzero on failure.
+    int build_relay_table (void);
+
+    // Records indexed by source type id (there is only one source sender).
+    vrpn_STREAMFORWARDERRECORD ** d_relayTable;
+    vrpn_int32 d_relayTableSize;
+    vrpn_bool d_relaying;
+
 };
 
 
@@ -6,6 +6,10 @@
 
 
 const vrpn_uint32 vrpn_FUNCTION_CHANNELS_MAX = vrpn_CHANNEL_MAX;
+const vrpn_uint32 vrpn_FUNCTION_COMPONENTS_MAX = 16;	// sine terms in a sum function
+const vrpn_uint32 vrpn_FUNCTION_TABLE_MAX = 4096;	// entries in a table function
+const vrpn_uint32 vrpn_FUNCTION_SCRIPT_CODE_MAX = 256;	// bytecodes in a compiled script
+const vrpn_uint32 vrpn_FUNCTION_SCRIPT_CONSTANTS_MAX = 64;	// numbers in a compiled script
 
 extern const char* vrpn_FUNCTION_MESSAGE_TYPE_CHANNEL;
 extern const char* vrpn_FUNCTION_MESSAGE_TYPE_CHANNEL_REQUEST;
@@ -62,7 +66,13 @@ public:
 	enum FunctionCode
 	{
 		FUNCTION_NULL = 0,
-		FUNCTION_SCRIPT = 1
+		FUNCTION_SCRIPT = 1,
+		FUNCTION_SINE = 2,
+		FUNCTION_SQUARE = 3,
+		FUNCTION_SAWTOOTH = 4,
+		FUNCTION_CHIRP = 5,
+		FUNCTION_TABLE = 6,
+		FUNCTION_SUM = 7
 	};
 
 	// concrete classes should implement this to return the
@@ -94,6 +104,13 @@ protected:
 };
 
 
+// a function given as an expression in the time t (in seconds).  the
+// script is compiled to bytecode when it is set, and the bytecode is run
+// over a block of samples at a time.  the syntax is
+//	numbers, t, pi, + - * / ^ (power), unary -, parentheses and
+//	sin cos tan exp log sqrt abs floor of a parenthesized argument
+// for example "0.5 * sin(2 * pi * 440 * t) + 0.1".  a script that does not
+// compile generates zeros; getCompileError() says why.
 class VRPN_API vrpn_FunctionGenerator_function_script
 : public virtual vrpn_FunctionGenerator_function
 {
@@ -120,10 +137,225 @@ public:
 
 	vrpn_bool setScript( char* script );
 
+	// true if the current script compiled.  otherwise getCompileError()
+	// describes the first problem found.
+	vrpn_bool isCompiled( ) const { return codeLength > 0; }
+	const char* getCompileError( ) const { return compileError; }
+
 protected:
 	FunctionCode getFunctionCode( ) const {  return FUNCTION_SCRIPT;  }
 	char* script;
 
+	// the compiled script:  a stack program over blocks of samples
+	void compile( );
+	vrpn_uint8 code[vrpn_FUNCTION_SCRIPT_CODE_MAX];
+	vrpn_uint32 codeLength;		// zero if the script did not compile
+	vrpn_float32 constants[vrpn_FUNCTION_SCRIPT_CONSTANTS_MAX];
+	vrpn_uint32 numConstants;
+	char compileError[128];
+
+};
+
+
+// a base class for functions that repeat frequency times a second.  the
+// channel keeps the phase between calls to generateValues(), so the output
+// is continuous across buffers and across changes of frequency as long as
+// each call starts where the last one ended.  otherwise the phase is
+// recomputed from startTime.  phase is in cycles (0 to 1).
+class VRPN_API vrpn_FunctionGenerator_function_periodic
+: public virtual vrpn_FunctionGenerator_function
+{
+public:
+	vrpn_FunctionGenerator_function_periodic( vrpn_float32 amplitude = 1,
+		vrpn_float32 frequency = 1, vrpn_float32 offset = 0, vrpn_float32 phase = 0 );
+	virtual ~vrpn_FunctionGenerator_function_periodic( ) { }
+
+	vrpn_float32 generateValues( vrpn_float32* buf, vrpn_uint32 nValues,
+								vrpn_float32 startTime, vrpn_float32 sampleRate, 
+								vrpn_FunctionGenerator_channel* channel ) const;
+
+	vrpn_int32 encode_to( char** buf, vrpn_int32& len ) const;
+	vrpn_int32 decode_from( const char** buf, vrpn_int32& len );
+
+	vrpn_float32 getAmplitude( ) const { return amplitude; }
+	vrpn_float32 getFrequency( ) const { return frequency; }
+	vrpn_float32 getOffset( ) const { return offset; }
+	vrpn_float32 getPhase( ) const { return phase; }
+	void setAmplitude( vrpn_float32 a ) { amplitude = a; }
+	void setFrequency( vrpn_float32 f ) { frequency = f; }
+	void setOffset( vrpn_float32 o ) { offset = o; }
+	void setPhase( vrpn_float32 p ) { phase = p; }
+
+protected:
+	// concrete classes fill buf[i] from the phases ph[i], each in [0,1)
+	virtual void shapeValues( vrpn_float32* buf, const vrpn_float32* ph,
+							  vrpn_uint32 n ) const = 0;
+
+	vrpn_float32 amplitude;
+	vrpn_float32 frequency;		// Hz
+	vrpn_float32 offset;		// added to every sample
+	vrpn_float32 phase;		// cycles added to the running phase
+};
+
+
+// amplitude * sin( 2 pi phase ) + offset
+class VRPN_API vrpn_FunctionGenerator_function_sine
+: public vrpn_FunctionGenerator_function_periodic
+{
+public:
+	vrpn_FunctionGenerator_function_sine( vrpn_float32 amplitude = 1,
+		vrpn_float32 frequency = 1, vrpn_float32 offset = 0, vrpn_float32 phase = 0 )
+		: vrpn_FunctionGenerator_function_periodic( amplitude, frequency, offset, phase ) { }
+
+	vrpn_FunctionGenerator_function* clone( ) const;
+protected:
+	FunctionCode getFunctionCode( ) const {  return FUNCTION_SINE;  }
+	void shapeValues( vrpn_float32* buf, const vrpn_float32* ph, vrpn_uint32 n ) const;
+};
+
+
+// +amplitude for the first dutyCycle of each period, -amplitude after, plus offset
+class VRPN_API vrpn_FunctionGenerator_function_square
+: public vrpn_FunctionGenerator_function_periodic
+{
+public:
+	vrpn_FunctionGenerator_function_square( vrpn_float32 amplitude = 1,
+		vrpn_float32 frequency = 1, vrpn_float32 offset = 0, vrpn_float32 phase = 0,
+		vrpn_float32 dutyCycle = 0.5f )
+		: vrpn_FunctionGenerator_function_periodic( amplitude, frequency, offset, phase ),
+		  dutyCycle( dutyCycle ) { }
+
+	vrpn_int32 encode_to( char** buf, vrpn_int32& len ) const;
+	vrpn_int32 decode_from( const char** buf, vrpn_int32& len );
+	vrpn_FunctionGenerator_function* clone( ) const;
+
+	vrpn_float32 getDutyCycle( ) const { return dutyCycle; }
+	void setDutyCycle( vrpn_float32 d ) { dutyCycle = d; }
+protected:
+	FunctionCode getFunctionCode( ) const {  return FUNCTION_SQUARE;  }
+	void shapeValues( vrpn_float32* buf, const vrpn_float32* ph, vrpn_uint32 n ) const;
+	vrpn_float32 dutyCycle;		// fraction of the period spent high
+};
+
+
+// rises from -amplitude to +amplitude over each period, plus offset
+class VRPN_API vrpn_FunctionGenerator_function_sawtooth
+: public vrpn_FunctionGenerator_function_periodic
+{
+public:
+	vrpn_FunctionGenerator_function_sawtooth( vrpn_float32 amplitude = 1,
+		vrpn_float32 frequency = 1, vrpn_float32 offset = 0, vrpn_float32 phase = 0 )
+		: vrpn_FunctionGenerator_function_periodic( amplitude, frequency, offset, phase ) { }
+
+	vrpn_FunctionGenerator_function* clone( ) const;
+protected:
+	FunctionCode getFunctionCode( ) const {  return FUNCTION_SAWTOOTH;  }
+	void shapeValues( vrpn_float32* buf, const vrpn_float32* ph, vrpn_uint32 n ) const;
+};
+
+
+// one period of an arbitrary waveform given as evenly-spaced entries,
+// linearly interpolated and scaled by amplitude, plus offset
+class VRPN_API vrpn_FunctionGenerator_function_table
+: public vrpn_FunctionGenerator_function_periodic
+{
+public:
+	vrpn_FunctionGenerator_function_table( vrpn_float32 amplitude = 1,
+		vrpn_float32 frequency = 1, vrpn_float32 offset = 0, vrpn_float32 phase = 0 );
+	vrpn_FunctionGenerator_function_table( const vrpn_FunctionGenerator_function_table& );
+	virtual ~vrpn_FunctionGenerator_function_table( );
+
+	vrpn_int32 encode_to( char** buf, vrpn_int32& len ) const;
+	vrpn_int32 decode_from( const char** buf, vrpn_int32& len );
+	vrpn_FunctionGenerator_function* clone( ) const;
+
+	// copies the entries.  returns false if there are none or more than
+	// vrpn_FUNCTION_TABLE_MAX.
+	vrpn_bool setTable( const vrpn_float32* entries, vrpn_uint32 numEntries );
+	const vrpn_float32* getTable( ) const { return table; }
+	vrpn_uint32 getTableSize( ) const { return tableSize; }
+protected:
+	FunctionCode getFunctionCode( ) const {  return FUNCTION_TABLE;  }
+	void shapeValues( vrpn_float32* buf, const vrpn_float32* ph, vrpn_uint32 n ) const;
+	vrpn_float32* table;	// tableSize entries, then a copy of the first
+	vrpn_uint32 tableSize;
+};
+
+
+// a sine whose frequency sweeps linearly from startFrequency to
+// endFrequency over duration seconds, then starts over.  the phase
+// stays continuous where each sweep starts over.
+class VRPN_API vrpn_FunctionGenerator_function_chirp
+: public virtual vrpn_FunctionGenerator_function
+{
+public:
+	vrpn_FunctionGenerator_function_chirp( vrpn_float32 amplitude = 1,
+		vrpn_float32 startFrequency = 1, vrpn_float32 endFrequency = 10,
+		vrpn_float32 duration = 1, vrpn_float32 offset = 0 );
+	virtual ~vrpn_FunctionGenerator_function_chirp( ) { }
+
+	vrpn_float32 generateValues( vrpn_float32* buf, vrpn_uint32 nValues,
+								vrpn_float32 startTime, vrpn_float32 sampleRate, 
+								vrpn_FunctionGenerator_channel* channel ) const;
+
+	vrpn_int32 encode_to( char** buf, vrpn_int32& len ) const;
+	vrpn_int32 decode_from( const char** buf, vrpn_int32& len );
+	vrpn_FunctionGenerator_function* clone( ) const;
+
+	vrpn_float32 getAmplitude( ) const { return amplitude; }
+	vrpn_float32 getStartFrequency( ) const { return startFrequency; }
+	vrpn_float32 getEndFrequency( ) const { return endFrequency; }
+	vrpn_float32 getDuration( ) const { return duration; }
+	vrpn_float32 getOffset( ) const { return offset; }
+	void setAmplitude( vrpn_float32 a ) { amplitude = a; }
+	void setFrequencies( vrpn_float32 start, vrpn_float32 end )
+	{ startFrequency = start; endFrequency = end; }
+	void setDuration( vrpn_float32 d ) { duration = d; }
+	void setOffset( vrpn_float32 o ) { offset = o; }
+
+protected:
+	FunctionCode getFunctionCode( ) const {  return FUNCTION_CHIRP;  }
+	vrpn_float32 amplitude;
+	vrpn_float32 startFrequency;	// Hz
+	vrpn_float32 endFrequency;	// Hz
+	vrpn_float32 duration;		// seconds per sweep
+	vrpn_float32 offset;
+};
+
+
+// offset plus a sum of up to vrpn_FUNCTION_COMPONENTS_MAX sines, each
+// with its own amplitude, frequency and phase (in cycles)
+class VRPN_API vrpn_FunctionGenerator_function_sum
+: public virtual vrpn_FunctionGenerator_function
+{
+public:
+	vrpn_FunctionGenerator_function_sum( vrpn_float32 offset = 0 );
+	virtual ~vrpn_FunctionGenerator_function_sum( ) { }
+
+	vrpn_float32 generateValues( vrpn_float32* buf, vrpn_uint32 nValues,
+								vrpn_float32 startTime, vrpn_float32 sampleRate, 
+								vrpn_FunctionGenerator_channel* channel ) const;
+
+	vrpn_int32 encode_to( char** buf, vrpn_int32& len ) const;
+	vrpn_int32 decode_from( const char** buf, vrpn_int32& len );
+	vrpn_FunctionGenerator_function* clone( ) const;
+
+	// returns false if there are already vrpn_FUNCTION_COMPONENTS_MAX
+	vrpn_bool addComponent( vrpn_float32 amplitude, vrpn_float32 frequency,
+							vrpn_float32 phase = 0 );
+	void clearComponents( ) { numComponents = 0; }
+	vrpn_uint32 getNumComponents( ) const { return numComponents; }
+
+	vrpn_float32 getOffset( ) const { return offset; }
+	void setOffset( vrpn_float32 o ) { offset = o; }
+
+protected:
+	FunctionCode getFunctionCode( ) const {  return FUNCTION_SUM;  }
+	vrpn_float32 offset;
+	vrpn_uint32 numComponents;
+	vrpn_float32 amplitudes[vrpn_FUNCTION_COMPONENTS_MAX];
+	vrpn_float32 frequencies[vrpn_FUNCTION_COMPONENTS_MAX];
+	vrpn_float32 phases[vrpn_FUNCTION_COMPONENTS_MAX];
 };
 
 
@@ -143,6 +375,13 @@ public:
 	vrpn_int32 encode_to( char** buf, vrpn_int32& len ) const;
 	vrpn_int32 decode_from( const char** buf, vrpn_int32& len );
 
+	// generation state that the functions carry from one buffer to the
+	// next.  nextTime is where the last buffer ended; a function that is
+	// asked to start anywhere else recomputes its phases from startTime.
+	vrpn_float64 phase[vrpn_FUNCTION_COMPONENTS_MAX];	// cycles, in [0,1)
+	vrpn_float64 sweepTime;		// seconds into the current chirp sweep
+	vrpn_float64 nextTime;		// negative until something is generated
+
 protected:
 	vrpn_FunctionGenerator_function* function;
 	
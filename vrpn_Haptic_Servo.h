@@ -0,0 +1,202 @@
+// vrpn_Haptic_Servo.h
+//	A haptic servo loop for force-feedback servers.  Haptic rendering
+// needs forces computed about a thousand times a second, much faster and
+// more steadily than a server's mainloop() runs when the network is busy.
+// vrpn_Haptic_Servo runs the loop on a thread of its own at a fixed rate:
+// each tick it reads the device's position, computes the force the current
+// effects (a force field and planes) make there, and applies it.  The
+// network side changes the effects, and reads back the device's state and
+// how steadily the loop is running, through buffers that neither side ever
+// waits on.
+//	vrpn_ForceDevice_Servo_Server is a vrpn_ForceDevice and vrpn_Tracker
+// server built on it: give it a vrpn_Haptic_Device that reads and drives
+// the hardware and it does the rest.
+
+#ifndef VRPN_HAPTIC_SERVO_H
+#define VRPN_HAPTIC_SERVO_H
+
+#include "vrpn_Shared.h"
+#include "vrpn_Tracker.h"
+#include "vrpn_ForceDevice.h"
+
+// Range of servo rates, in ticks per second.
+const vrpn_float64 vrpn_HAPTIC_MIN_RATE = 1000.0;
+const vrpn_float64 vrpn_HAPTIC_MAX_RATE = 4000.0;
+
+// Hands the latest value of a T from one thread to one other without either
+// of them waiting.  It is a double buffer with a third slot (see
+// vrpn_Triple_Buffer), so that the writer always has a slot of its own to
+// fill while the reader holds another.
+template <class T>
+class vrpn_Haptic_Buffer {
+  public:
+    // Sets every slot to value.  Call before either thread uses it.
+    void init (const T & value) {
+      d_slot[0] = d_slot[1] = d_slot[2] = value;
+    }
+
+    // Called by the writing thread only.
+    void write (const T & value) {
+      d_slot[d_index.write_slot()] = value;
+      d_index.publish();
+    }
+
+    // Called by the reading thread only.  Copies the latest value into
+    // value and returns true if it was written since the last read; if
+    // not, copies the value read last time and returns false.
+    bool read (T & value) {
+      bool fresh = d_index.acquire();
+      value = d_slot[d_index.read_slot()];
+      return fresh;
+    }
+
+  protected:
+    T d_slot[3];
+    vrpn_Triple_Buffer d_index;
+};
+
+// The effects the servo loop renders.  Like the messages they come from,
+// positions are in the device's frame and forces in its units.
+struct VRPN_API vrpn_Haptic_Effects {
+  vrpn_Haptic_Effects (void) { clear(); }
+
+  // Turns every effect off.
+  void clear (void);
+
+  // Sets the force at pos, moving at vel, from all of the effects.
+  void compute_force (const vrpn_float64 pos[3], const vrpn_float64 vel[3],
+                      vrpn_float64 force[3]) const;
+
+  // A force field, as sent by vrpn_ForceDevice_Remote::sendForceField():
+  // within ff_radius of ff_origin, the force is ff_force plus ff_jacobian
+  // times the offset from ff_origin.  Outside it (or with radius 0, as
+  // stopForceField() sends) there is none.
+  vrpn_float32 ff_origin[3];
+  vrpn_float32 ff_force[3];
+  vrpn_float32 ff_jacobian[3][3];
+  vrpn_float32 ff_radius;
+
+  // Planes, as sent by vrpn_ForceDevice_Remote::startSurface(): the
+  // surface ax + by + cz + d = 0, with (a, b, c) pointing out of it.  Below
+  // the surface the device is pushed back out by kspring times its depth,
+  // less kdamping times its speed into the surface.  An all-zero plane (as
+  // stopSurface() sends) is off.
+  vrpn_bool plane_on[MAXPLANE];
+  vrpn_float32 plane[MAXPLANE][4];
+  vrpn_float32 plane_kspring[MAXPLANE];
+  vrpn_float32 plane_kdamping[MAXPLANE];
+};
+
+// What the servo loop last did, and how steadily it has been doing it.
+struct vrpn_Haptic_Servo_State {
+  struct timeval time;          // When the position was read
+  vrpn_float64 pos[3];          // Where the device was
+  vrpn_float64 vel[3];          // How fast it was moving
+  vrpn_float64 force[3];        // The force applied there
+  vrpn_uint32 ticks;            // Ticks since the loop started
+  vrpn_uint32 overruns;         // Ticks that ran past the next one's start
+  vrpn_uint32 failures;         // Ticks where the device could not be read or driven
+  vrpn_float64 rate;            // Ticks per second, over the last second
+  vrpn_float64 jitter;          // RMS difference of the time between ticks
+                                //  from the nominal period (seconds), over the last second
+  vrpn_float64 max_jitter;      // Largest such difference, over the last second
+};
+
+// What the servo loop needs from a device.  While the loop is running it
+// calls these from its own thread, and nothing else should.
+class VRPN_API vrpn_Haptic_Device {
+  public:
+    virtual ~vrpn_Haptic_Device (void) { }
+
+    // Reads where the device is and how fast it is moving.  Returns false
+    // if it could not be read.
+    virtual bool read_position (vrpn_float64 pos[3], vrpn_float64 vel[3]) = 0;
+
+    // Drives the device with a force.  Returns false if it could not.
+    virtual bool apply_force (const vrpn_float64 force[3]) = 0;
+};
+
+class VRPN_API vrpn_Haptic_Servo {
+  public:
+    // The rate is kept between vrpn_HAPTIC_MIN_RATE and vrpn_HAPTIC_MAX_RATE.
+    vrpn_Haptic_Servo (vrpn_Haptic_Device * device, vrpn_float64 rate = 1000.0);
+    ~vrpn_Haptic_Servo (void);
+
+    // Starts and stops the thread.  start() returns false where there are
+    // no threads; the owner can then call tick() itself from mainloop().
+    // While stopped, the device is left with no force on it.
+    bool start (void);
+    void stop (void);
+    bool running (void) const { return d_thread != NULL; }
+
+    // Whether the thread got real-time scheduling from the system.
+    bool realtime (void) const { return d_realtime; }
+
+    vrpn_float64 rate (void) const { return d_rate; }
+
+    // Called by the network side: replaces the effects being rendered,
+    // and gets the latest state (returning true if it is new).
+    void set_effects (const vrpn_Haptic_Effects & effects) { d_effects.write(effects); }
+    bool get_state (vrpn_Haptic_Servo_State & state) { return d_state.read(state); }
+
+    // Runs one tick on the calling thread.
+    void tick (void);
+
+  protected:
+    static void servo_thread (vrpn_ThreadData & threadData);
+    void run (void);
+    void count_tick (vrpn_float64 now);
+
+    vrpn_Haptic_Device *d_device;
+    vrpn_float64 d_rate;
+    vrpn_Thread *d_thread;
+    volatile long d_stop;         // Set to ask the thread to stop
+    bool d_realtime;
+
+    vrpn_Haptic_Buffer<vrpn_Haptic_Effects> d_effects;
+    vrpn_Haptic_Buffer<vrpn_Haptic_Servo_State> d_state;
+
+    // Used only by the thread running the ticks.
+    vrpn_Haptic_Effects d_rendering;      // Effects being rendered
+    vrpn_Haptic_Servo_State d_current;    // State being built
+    vrpn_float64 d_last_tick;             // When the last tick started (seconds)
+    vrpn_float64 d_window_start;          // When this second's stats began
+    vrpn_uint32 d_window_ticks;           // Ticks in it
+    vrpn_float64 d_window_sum_sq;         // Sum of squared period differences in it
+    vrpn_float64 d_window_max;            // Largest period difference in it
+};
+
+// A force-feedback server whose forces are computed by a vrpn_Haptic_Servo.
+// It renders the force field and plane messages from a
+// vrpn_ForceDevice_Remote, reports the device's position and velocity as
+// a tracker (sensor 0) and the force applied as force messages, at
+// report_rate, and sends an FD_DUTY_CYCLE_ERROR whenever the servo loop
+// has overrun since the last report.  When the last client goes, the
+// effects are turned off.  The device is not deleted.
+class VRPN_API vrpn_ForceDevice_Servo_Server : public vrpn_Tracker, public vrpn_ForceDevice {
+  public:
+    vrpn_ForceDevice_Servo_Server (const char * name, vrpn_Connection * c,
+                                   vrpn_Haptic_Device * device,
+                                   vrpn_float64 servo_rate = 1000.0,
+                                   vrpn_float64 report_rate = 100.0);
+    virtual ~vrpn_ForceDevice_Servo_Server (void);
+
+    virtual void mainloop (void);
+
+    vrpn_Haptic_Servo *servo (void) { return &d_servo; }
+
+  protected:
+    static int VRPN_CALLBACK handle_forcefield_message (void * userdata, vrpn_HANDLERPARAM p);
+    static int VRPN_CALLBACK handle_plane_message (void * userdata, vrpn_HANDLERPARAM p);
+    static int VRPN_CALLBACK handle_dropped_last_connection (void * userdata, vrpn_HANDLERPARAM p);
+
+    void send_report (const vrpn_Haptic_Servo_State & state);
+
+    vrpn_Haptic_Servo d_servo;
+    vrpn_Haptic_Effects d_effects;        // What the clients have asked for
+    vrpn_float64 d_report_interval;       // Seconds between reports
+    struct timeval d_last_report;
+    vrpn_uint32 d_reported_overruns;      // Servo overruns at the last report
+};
+
+#endif
@@ -1,8 +1,8 @@
 // ImagerControl (should be built into Imager, because it will always
 // be the same device).  The app doesn't have to use all of the
 // functions if they don't want to.
-// XXX Client can sent request for only subregion of image to be sent
-//     Server may ignore this message.
+// Client can subscribe to only a subregion of the image, decimated and at a
+//     lower frame rate (vrpn_Imager_Remote::subscribe()).
 // XXX Server sets region back to total region when last connection closed.
 // XXX Client can request a frame rate from the server.  This is passed on
 //     to the server code as a handled message.  Server should reset to the
@@ -23,6 +23,7 @@
 #include <string.h>	// For memcpy()
 #include  "vrpn_Connection.h"
 #include  "vrpn_BaseClass.h"
+#include  "vrpn_BufferUtils.h"
 
 const unsigned vrpn_IMAGER_MAX_CHANNELS = 100;
 
@@ -109,6 +110,8 @@ protected:
   vrpn_int32	d_end_frame_m_id;	//< ID of the message type describing the start of a region
   vrpn_int32	d_discarded_frames_m_id;//< ID of the message type describing the discarding of one or more regions
   vrpn_int32	d_throttle_frames_m_id;	//< ID of the message type requesting throttling of sending.
+  vrpn_int32	d_subscribe_m_id;	//< ID of the message type requesting a reduced image
+  vrpn_int32	d_unsubscribe_m_id;	//< ID of the message type cancelling a reduced image
   vrpn_int32	d_regionu8_m_id;	//< ID of the message type describing a region with 8-bit unsigned entries
   vrpn_int32	d_regionu12in16_m_id;   //< ID of the message type describing a region with 12-bit unsigned entries packed in 16 bits
   vrpn_int32	d_regionu16_m_id;	//< ID of the message type describing a region with 16-bit unsigned entries
@@ -119,6 +122,7 @@ class VRPN_API vrpn_Imager_Server: public vrpn_Imager {
 public:
   vrpn_Imager_Server(const char *name, vrpn_Connection *c,
 		     vrpn_int32 nCols, vrpn_int32 nRows, vrpn_int32 nDepth = 1);
+  virtual ~vrpn_Imager_Server();
 
   /// Add a channel to the server, returns index of the channel or -1 on failure.
   int	add_channel(const char *name, const char *units = "unsigned8bit",
@@ -196,11 +200,88 @@ public:
   /// Handle baseclass ping/pong messages
   virtual void	mainloop(void);
 
+  /// Clients can subscribe to a reduced image (see vrpn_Imager_Remote::subscribe()).
+  // The begin/end frame, discarded frame and region calls above also send each
+  // subscriber its own part of what they send, packed only to that client.
+  // Everyone else gets the full image.  This tells how many subscriptions there are.
+  int	num_subscriptions(void) const;
+
 protected:
   bool	      d_description_sent;   //< Has the description message been sent?
   vrpn_int32  d_frames_to_send;	    //< Set to -1 if continuous, zero or positive tells how many to send and then start dropping
   vrpn_uint16 d_dropped_due_to_throttle;  //< Number of frames dropped due to the throttle request
 
+  /// One client's subscription.  The region of interest is in pixels of the
+  // full image.  The subscriber sees it as an image of its own, whose (0,0,0)
+  // pixel is (cMin,rMin,dMin) and which keeps every decimation'th row and column.
+  struct subscription {
+    cName	name;		    //< Name of the sender the client registered for it
+    vrpn_int32	sender;		    //< Our ID for that sender
+    bool	channels[vrpn_IMAGER_MAX_CHANNELS];  //< Which channels to send
+    vrpn_uint16	cMin, cMax, rMin, rMax, dMin, dMax; //< Region of interest
+    vrpn_uint16	decimation;	    //< Send every decimation'th row and column
+    struct timeval minInterval;	    //< Least time between frames (zero for every frame)
+    struct timeval lastFrame;	    //< Time of the last frame sent
+    bool	inFrame;	    //< Is a frame being sent to this subscriber?
+    subscription *next;
+  };
+  subscription	*d_subscriptions;   //< List of subscriptions
+  bool	d_reap_subscriptions;	    //< Has a connection dropped since we last looked?
+
+  /// Where one region lands in a subscriber's image, and how to get at its source data.
+  struct subregion {
+    vrpn_uint16	cMin, cMax, rMin, rMax, dMin, dMax; //< Range in the subscriber's image
+    long	offset;		    //< Elements from the base pointer to the subscriber's (0,0,0)
+    vrpn_uint32	colStride, rowStride;	//< Strides between the subscriber's pixels
+    vrpn_uint16	nRows;		    //< Rows in the subscriber's image
+  };
+
+  subscription	*find_subscription(const char *name);
+  void	delete_subscription(subscription *s);
+
+  /// Region of interest clipped to the image; returns false if nothing is left.
+  bool	subscription_roi(const subscription *s, vrpn_uint16 *cMin, vrpn_uint16 *cMax,
+			 vrpn_uint16 *rMin, vrpn_uint16 *rMax,
+			 vrpn_uint16 *dMin, vrpn_uint16 *dMax) const;
+
+  /// Maps a range in the full image into a subscriber's image.  Returns false
+  // if the subscriber sees none of it.
+  bool	map_range(const subscription *s, vrpn_uint16 cMin, vrpn_uint16 cMax,
+		  vrpn_uint16 rMin, vrpn_uint16 rMax, vrpn_uint16 dMin, vrpn_uint16 dMax,
+		  subregion *out) const;
+
+  /// Maps a region being sent into a subscriber's image, including the strides
+  // and offset that pick its pixels out of the caller's data.  Returns false if
+  // the subscriber should not get any of it.
+  bool	map_region(const subscription *s, vrpn_int16 chanIndex,
+		   vrpn_uint16 cMin, vrpn_uint16 cMax, vrpn_uint16 rMin, vrpn_uint16 rMax,
+		   vrpn_uint32 colStride, vrpn_uint32 rowStride, vrpn_uint16 nRows,
+		   bool invert_rows, vrpn_uint32 depthStride,
+		   vrpn_uint16 dMin, vrpn_uint16 dMax, subregion *out) const;
+
+  /// Pack the messages for a stream;  the sender is ours or a subscriber's.
+  bool	pack_description(vrpn_int32 sender, vrpn_int32 nCols, vrpn_int32 nRows,
+			 vrpn_int32 nDepth, vrpn_uint32 class_of_service);
+  bool	send_subscription_description(const subscription *s);
+  bool	pack_frame(vrpn_int32 type, vrpn_int32 sender, vrpn_uint32 class_of_service,
+		   vrpn_uint16 cMin, vrpn_uint16 cMax, vrpn_uint16 rMin, vrpn_uint16 rMax,
+		   vrpn_uint16 dMin, vrpn_uint16 dMax, const struct timeval &timestamp);
+  bool	pack_region(vrpn_int32 sender, vrpn_uint32 class_of_service, vrpn_int16 chanIndex,
+		    vrpn_uint16 cMin, vrpn_uint16 cMax, vrpn_uint16 rMin, vrpn_uint16 rMax,
+		    const vrpn_uint8 *data, vrpn_uint32 colStride, vrpn_uint32 rowStride,
+		    vrpn_uint16 nRows, bool invert_rows, vrpn_uint32 depthStride,
+		    vrpn_uint16 dMin, vrpn_uint16 dMax, const struct timeval &timestamp);
+  bool	pack_region(vrpn_int32 sender, vrpn_uint32 class_of_service, vrpn_int16 chanIndex,
+		    vrpn_uint16 cMin, vrpn_uint16 cMax, vrpn_uint16 rMin, vrpn_uint16 rMax,
+		    const vrpn_uint16 *data, vrpn_uint32 colStride, vrpn_uint32 rowStride,
+		    vrpn_uint16 nRows, bool invert_rows, vrpn_uint32 depthStride,
+		    vrpn_uint16 dMin, vrpn_uint16 dMax, const struct timeval &timestamp);
+  bool	pack_region(vrpn_int32 sender, vrpn_uint32 class_of_service, vrpn_int16 chanIndex,
+		    vrpn_uint16 cMin, vrpn_uint16 cMax, vrpn_uint16 rMin, vrpn_uint16 rMax,
+		    const vrpn_float32 *data, vrpn_uint32 colStride, vrpn_uint32 rowStride,
+		    vrpn_uint16 nRows, bool invert_rows, vrpn_uint32 depthStride,
+		    vrpn_uint16 dMin, vrpn_uint16 dMax, const struct timeval &timestamp);
+
   // This method makes sure we send a description whenever we get a ping from
   // a client object.
   static  int VRPN_CALLBACK handle_ping_message(void *userdata, vrpn_HANDLERPARAM p);
@@ -208,6 +289,11 @@ protected:
   // This method handles requests to throttle the number of frames.
   static  int VRPN_CALLBACK handle_throttle_message(void *userdata, vrpn_HANDLERPARAM p);
   static  int VRPN_CALLBACK handle_last_drop_message(void *userdata, vrpn_HANDLERPARAM p);
+
+  // These methods keep track of subscriptions.
+  static  int VRPN_CALLBACK handle_subscribe_message(void *userdata, vrpn_HANDLERPARAM p);
+  static  int VRPN_CALLBACK handle_unsubscribe_message(void *userdata, vrpn_HANDLERPARAM p);
+  static  int VRPN_CALLBACK handle_dropped_connection_message(void *userdata, vrpn_HANDLERPARAM p);
 };
 
 class VRPN_API	vrpn_ImagerPose: public vrpn_BaseClass {
@@ -403,13 +489,12 @@ public:
       if ((d_valType != vrpn_IMAGER_VALTYPE_UINT16) && (d_valType != vrpn_IMAGER_VALTYPE_UINT12IN16) ) {
 	fprintf(stderr, "XXX vrpn_Imager_Region::read_unscaled_pixel(): Transcoding not implemented yet\n");
 	return false;
-      } else if (vrpn_big_endian) {
-	fprintf(stderr, "XXX vrpn_Imager_Region::read_unscaled_pixel(): Not implemented on big-endian yet\n");
-	return false;
       } else {
 	// The data is packed in with column varying fastest, row varying next, and depth
-	// varying slowest.  Depth steps are therefore the largest steps.
-	val = ((vrpn_uint16 *)d_valBuf)[(c - d_cMin) + (d_cMax - d_cMin+1)*( (r - d_rMin) + (d - d_dMin)*(d_rMax - d_rMin+1) )];
+	// varying slowest.  Depth steps are therefore the largest steps.  It was sent
+	// little-endian.
+	const vrpn_uint16 *pixel = &((const vrpn_uint16 *)d_valBuf)[(c - d_cMin) + (d_cMax - d_cMin+1)*( (r - d_rMin) + (d - d_dMin)*(d_rMax - d_rMin+1) )];
+	vrpn_byte_order::convert_little_endian_array<vrpn_uint16>((char *)&val, (const char *)pixel, 1);
       }
     }
     return true;
@@ -425,13 +510,12 @@ public:
       if (d_valType != vrpn_IMAGER_VALTYPE_FLOAT32) {
 	fprintf(stderr, "XXX vrpn_Imager_Region::read_unscaled_pixel(): Transcoding not implemented yet\n");
 	return false;
-      } else if (vrpn_big_endian) {
-	fprintf(stderr, "XXX vrpn_Imager_Region::read_unscaled_pixel(): Not implemented on big-endian yet\n");
-	return false;
       } else {
 	// The data is packed in with column varying fastest, row varying next, and depth
-	// varying slowest.  Depth steps are therefore the largest steps.
-	val = ((vrpn_float32 *)d_valBuf)[(c - d_cMin) + (d_cMax - d_cMin+1)*( (r - d_rMin) + (d - d_dMin)*(d_rMax - d_rMin+1) )];
+	// varying slowest.  Depth steps are therefore the largest steps.  It was sent
+	// little-endian.
+	const vrpn_float32 *pixel = &((const vrpn_float32 *)d_valBuf)[(c - d_cMin) + (d_cMax - d_cMin+1)*( (r - d_rMin) + (d - d_dMin)*(d_rMax - d_rMin+1) )];
+	vrpn_byte_order::convert_little_endian_array<vrpn_float32>((char *)&val, (const char *)pixel, 1);
       }
     }
     return true;
@@ -515,6 +599,24 @@ public:
   // which is the default.
   virtual bool throttle_sender(vrpn_int32 N);
 
+  /// Ask the server for a reduced image instead of the full one:  only the
+  // listed channels (all of them if channels is NULL), only the region of
+  // interest, only every decimation'th row and column, and no more than
+  // maxRate frames per second of frame time (zero for every frame).  The
+  // image this object then describes starts at pixel (cMin,rMin,dMin) of the
+  // full image and is decimation times smaller in rows and columns; region
+  // callbacks resume once its description arrives.  Calling this again
+  // changes the subscription.  Returns true on success.
+  virtual bool subscribe(vrpn_uint16 cMin, vrpn_uint16 cMax,
+			 vrpn_uint16 rMin, vrpn_uint16 rMax,
+			 vrpn_uint16 decimation = 1, vrpn_float64 maxRate = 0,
+			 const vrpn_int16 *channels = NULL, vrpn_int16 numChannels = 0,
+			 vrpn_uint16 dMin = 0, vrpn_uint16 dMax = 0);
+
+  /// Go back to receiving the full image.
+  virtual bool unsubscribe(void);
+  bool	is_subscribed(void) const { return d_subscribed; }
+
   /// XXX It could be nice to let the user specify separate callbacks for
   // region size changed (which would be called only if the description had
   // a different region size than the last time, and also the first time it
@@ -539,6 +641,15 @@ public:
 
 protected:
   bool	  d_got_description;	//< Have we gotten a description yet?
+
+  // Subscription state.  Image messages are only taken from d_stream_id,
+  // which is our sender unless we are subscribed.
+  bool	      d_subscribed;	      //< Are we subscribed to a reduced image?
+  vrpn_int32  d_subscription_id;      //< Sender for our subscription (-1 before the first)
+  vrpn_int32  d_stream_id;	      //< Sender whose image messages we use
+  vrpn_float64 d_subscription_buf[64]; //< Last subscribe message, resent on reconnection
+  vrpn_int32  d_subscription_len;     //< Length of the message in d_subscription_buf
+  bool	      send_subscription(void);
   // Lists to keep track of registered user handlers.
   vrpn_Callback_List<struct timeval>		    d_description_list;
   vrpn_Callback_List<vrpn_IMAGERREGIONCB>	    d_region_list;
@@ -555,6 +666,9 @@ protected:
   /// Handler for connection dropped message
   static int VRPN_CALLBACK handle_connection_dropped_message(void *userdata, vrpn_HANDLERPARAM p);
 
+  /// Handler for connection (re)established message;  resends our subscription
+  static int VRPN_CALLBACK handle_got_connection_message(void *userdata, vrpn_HANDLERPARAM p);
+
   /// Handler for begin-frame message from the server.
   static int VRPN_CALLBACK handle_begin_frame_message(void *userdata, vrpn_HANDLERPARAM p);
 
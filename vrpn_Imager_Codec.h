@@ -0,0 +1,439 @@
+#ifndef VRPN_IMAGER_CODEC_H
+#define VRPN_IMAGER_CODEC_H
+//Warning: this file automatically generated using the command line
+// util/gen_rpc/gen_vrpn_rpc.pl -t vrpn_Imager.vrpndef
+//DO NOT EDIT! Edit the source file instead.
+
+#include "vrpn_BufferUtils.h"
+
+class vrpn_Imager_Codec {
+  public:
+
+  struct Begin_Frame {
+    vrpn_uint16 dMin;
+    vrpn_uint16 dMax;
+    vrpn_uint16 rMin;
+    vrpn_uint16 rMax;
+    vrpn_uint16 cMin;
+    vrpn_uint16 cMax;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, dMin);
+      vrpn_codec::put(&buf, dMax);
+      vrpn_codec::put(&buf, rMin);
+      vrpn_codec::put(&buf, rMax);
+      vrpn_codec::put(&buf, cMin);
+      vrpn_codec::put(&buf, cMax);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &dMin);
+      vrpn_codec::get(&buf, &dMax);
+      vrpn_codec::get(&buf, &rMin);
+      vrpn_codec::get(&buf, &rMax);
+      vrpn_codec::get(&buf, &cMin);
+      vrpn_codec::get(&buf, &cMax);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_dMin(NULL), d_dMax(NULL), d_rMin(NULL), d_rMax(NULL), d_cMin(NULL), d_cMax(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_dMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_dMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_rMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_rMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_cMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_cMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          return fixed_size;
+        }
+
+        vrpn_uint16 dMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_dMin);
+        }
+        vrpn_uint16 dMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_dMax);
+        }
+        vrpn_uint16 rMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_rMin);
+        }
+        vrpn_uint16 rMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_rMax);
+        }
+        vrpn_uint16 cMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_cMin);
+        }
+        vrpn_uint16 cMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_cMax);
+        }
+
+      private:
+        const char * d_dMin;
+        const char * d_dMax;
+        const char * d_rMin;
+        const char * d_rMax;
+        const char * d_cMin;
+        const char * d_cMax;
+    };
+  };
+
+  struct End_Frame {
+    vrpn_uint16 dMin;
+    vrpn_uint16 dMax;
+    vrpn_uint16 rMin;
+    vrpn_uint16 rMax;
+    vrpn_uint16 cMin;
+    vrpn_uint16 cMax;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, dMin);
+      vrpn_codec::put(&buf, dMax);
+      vrpn_codec::put(&buf, rMin);
+      vrpn_codec::put(&buf, rMax);
+      vrpn_codec::put(&buf, cMin);
+      vrpn_codec::put(&buf, cMax);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &dMin);
+      vrpn_codec::get(&buf, &dMax);
+      vrpn_codec::get(&buf, &rMin);
+      vrpn_codec::get(&buf, &rMax);
+      vrpn_codec::get(&buf, &cMin);
+      vrpn_codec::get(&buf, &cMax);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_dMin(NULL), d_dMax(NULL), d_rMin(NULL), d_rMax(NULL), d_cMin(NULL), d_cMax(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_dMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_dMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_rMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_rMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_cMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_cMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          return fixed_size;
+        }
+
+        vrpn_uint16 dMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_dMin);
+        }
+        vrpn_uint16 dMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_dMax);
+        }
+        vrpn_uint16 rMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_rMin);
+        }
+        vrpn_uint16 rMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_rMax);
+        }
+        vrpn_uint16 cMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_cMin);
+        }
+        vrpn_uint16 cMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_cMax);
+        }
+
+      private:
+        const char * d_dMin;
+        const char * d_dMax;
+        const char * d_rMin;
+        const char * d_rMax;
+        const char * d_cMin;
+        const char * d_cMax;
+    };
+  };
+
+  struct Discarded_Frames {
+    vrpn_uint16 count;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_uint16>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, count);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &count);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_count(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_count = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          return fixed_size;
+        }
+
+        vrpn_uint16 count (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_count);
+        }
+
+      private:
+        const char * d_count;
+    };
+  };
+
+  struct Throttle_Frames {
+    vrpn_int32 count;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int32>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, count);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &count);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_count(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_count = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          return fixed_size;
+        }
+
+        vrpn_int32 count (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_count);
+        }
+
+      private:
+        const char * d_count;
+    };
+  };
+
+  struct Region {
+    vrpn_int16 chanIndex;
+    vrpn_uint16 dMin;
+    vrpn_uint16 dMax;
+    vrpn_uint16 rMin;
+    vrpn_uint16 rMax;
+    vrpn_uint16 cMin;
+    vrpn_uint16 cMax;
+    vrpn_uint16 valType;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value
+      + vrpn_codec::wire_size<vrpn_uint16>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, chanIndex);
+      vrpn_codec::put(&buf, dMin);
+      vrpn_codec::put(&buf, dMax);
+      vrpn_codec::put(&buf, rMin);
+      vrpn_codec::put(&buf, rMax);
+      vrpn_codec::put(&buf, cMin);
+      vrpn_codec::put(&buf, cMax);
+      vrpn_codec::put(&buf, valType);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &chanIndex);
+      vrpn_codec::get(&buf, &dMin);
+      vrpn_codec::get(&buf, &dMax);
+      vrpn_codec::get(&buf, &rMin);
+      vrpn_codec::get(&buf, &rMax);
+      vrpn_codec::get(&buf, &cMin);
+      vrpn_codec::get(&buf, &cMax);
+      vrpn_codec::get(&buf, &valType);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_chanIndex(NULL), d_dMin(NULL), d_dMax(NULL), d_rMin(NULL), d_rMax(NULL), d_cMin(NULL), d_cMax(NULL), d_valType(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_chanIndex = buf;
+          buf += vrpn_codec::wire_size<vrpn_int16>::value;
+          d_dMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_dMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_rMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_rMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_cMin = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_cMax = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          d_valType = buf;
+          buf += vrpn_codec::wire_size<vrpn_uint16>::value;
+          return fixed_size;
+        }
+
+        vrpn_int16 chanIndex (void) const {
+          return vrpn_codec::read<vrpn_int16>(d_chanIndex);
+        }
+        vrpn_uint16 dMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_dMin);
+        }
+        vrpn_uint16 dMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_dMax);
+        }
+        vrpn_uint16 rMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_rMin);
+        }
+        vrpn_uint16 rMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_rMax);
+        }
+        vrpn_uint16 cMin (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_cMin);
+        }
+        vrpn_uint16 cMax (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_cMax);
+        }
+        vrpn_uint16 valType (void) const {
+          return vrpn_codec::read<vrpn_uint16>(d_valType);
+        }
+
+      private:
+        const char * d_chanIndex;
+        const char * d_dMin;
+        const char * d_dMax;
+        const char * d_rMin;
+        const char * d_rMax;
+        const char * d_cMin;
+        const char * d_cMax;
+        const char * d_valType;
+    };
+  };
+
+};
+
+#endif // VRPN_IMAGER_CODEC_H
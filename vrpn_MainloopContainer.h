@@ -52,6 +52,20 @@ class vrpn_MainloopContainer {
 			return o;
 		}
 
+		/// Remove an object, deleting it.  Returns false if it
+		/// was not in the container.
+		bool remove(vrpn_MainloopObject * o);
+
+		/// Template method to find the wrapper of an object
+		/// and remove it, deleting the object.
+		template<class T>
+		bool remove(T o) {
+			vrpn_MainloopObject * key = vrpn_MainloopObject::wrap(o, false);
+			bool found = remove(key);
+			delete key;
+			return found;
+		}
+
 		/// Runs mainloop on all contained objects, in the order
 		/// that they were added.
 		void mainloop();
@@ -86,6 +100,17 @@ inline void vrpn_MainloopContainer::clear() {
 	_vrpn.clear();
 }
 
+inline bool vrpn_MainloopContainer::remove(vrpn_MainloopObject * o) {
+	for (size_t i = 0; i < _vrpn.size(); ++i) {
+		if (*(_vrpn[i]) == *o) {
+			delete _vrpn[i];
+			_vrpn.erase(_vrpn.begin() + i);
+			return true;
+		}
+	}
+	return false;
+}
+
 inline void vrpn_MainloopContainer::mainloop() {
 	const size_t n = _vrpn.size();
 	for (size_t i = 0; i < n; ++i) {
@@ -201,9 +201,25 @@ class VRPN_API vrpn_Mutex_Remote : public vrpn_Mutex {
 // Handling more than 2 sites in a mutex requires multiconnection servers.
 // It's been tested with 1-3 sites, and works fine.
 
-// This is an O(n^2) network traffic implementation;
-// for details (and how to fix if it ever becomes a problem),
-// see the implementation notes in vrpn_Mutex.C.
+// Each vote costs 2n messages (a request to every peer and one reply from
+// each) as long as every site can map the requester's IP number and port
+// back onto one of its peers;  otherwise replies are broadcast and the
+// traffic is O(n^2).  See the implementation notes in vrpn_Mutex.C.
+
+// Lease mode -
+
+//   If setLeaseDuration() is given a nonzero duration, a site that wins a
+// vote keeps a lease on the mutex after it releases it.  While the lease is
+// valid, request() grants the mutex immediately without sending any
+// messages, and the matching release() is also silent.  Every other site
+// still thinks the mutex is available, so when one of them requests it the
+// vote reaches the lease holder:  if the holder isn't using the mutex it
+// grants the request and gives up its lease, and if it is it denies the
+// request, announces its next release to everybody and gives up its lease
+// then.  Contention therefore always falls back to the ordinary vote.
+//   Take and Release callbacks at other sites are not triggered for
+// acquisitions made under a lease, and isAvailable() at other sites does
+// not reflect them.
 
 
 
@@ -254,6 +270,14 @@ class VRPN_API vrpn_PeerMutex {
 
     void addPeer (const char * stationName);
       ///< Takes a VRPN station name of the form "<host>:<port>".
+      ///< Gives up any lease we hold.
+
+    void setLeaseDuration (const timeval & duration);
+      ///< Enables lease mode if duration is nonzero;  a lease we win
+      ///< lasts this long after each release().  Zero (the default)
+      ///< disables lease mode and gives up any lease we hold.
+    vrpn_bool hasLease (void) const;
+      ///< True if the next request() will be granted without a vote.
 
 
     void addRequestGrantedCallback (void * userdata, int (*) (void *));
@@ -286,18 +310,42 @@ class VRPN_API vrpn_PeerMutex {
 
     vrpn_Connection * d_server;
       ///< Receive on this connection.
-    vrpn_Connection ** d_peer;
-      ///< Send on these connections to other Mutex's well-known-ports.
 
+    struct peerData {
+      vrpn_Connection * connection;
+        ///< Send on this connection to the peer's well-known-port.
+      vrpn_uint32 IPaddress;
+      vrpn_uint32 localIPaddress;
+      vrpn_uint32 port;
+        ///< Where the peer's requests come from, as far as we can tell
+        ///< from its station name;  IPaddress is 0 if we couldn't tell.
+        ///< A peer named by a loopback address may instead be using
+        ///< this machine's default address, localIPaddress.
+      vrpn_bool lost;
+        ///< Connection dropped;  reaped by mainloop().
+      vrpn_PeerMutex * mutex;
+      peerData * next;
+    };
+
+    peerData * d_peers;
+      ///< Linked list of the other Mutexes, one record per addPeer().
     int d_numPeers;
-    int d_numConnectionsAllocated;
-      ///< Dynamic array size for d_peer and d_peerGrantedLock.
+      ///< Count of the peers in d_peers that haven't been lost.
 
     vrpn_uint32 d_myIP;
     vrpn_uint32 d_myPort;
     vrpn_uint32 d_holderIP;
     vrpn_int32 d_holderPort;
 
+    timeval d_leaseDuration;
+    timeval d_leaseExpires;
+    vrpn_bool d_haveLease;
+    vrpn_bool d_heldOnLease;
+      ///< The current hold was taken under the lease, so nobody else
+      ///< knows about it and release() need not tell them.
+    vrpn_bool d_leaseContended;
+      ///< We denied somebody's request while holding the mutex.
+
     vrpn_int32 d_myId;
     vrpn_int32 d_request_type;
     vrpn_int32 d_release_type;
@@ -325,6 +373,9 @@ class VRPN_API vrpn_PeerMutex {
     void triggerReleaseCallbacks (void);
 
     void checkGrantMutex (void);
+    vrpn_bool leaseValid (void) const;
+    peerData * findPeer (vrpn_uint32 IPnumber, vrpn_uint32 PortNumber) const;
+    void reapLostPeers (void);
 
     void init (const char * name);
 
@@ -339,17 +390,6 @@ class VRPN_API vrpn_PeerMutex {
     mutexCallback * d_takeCB;
     mutexCallback * d_releaseCB;
 
-    struct peerData {
-      vrpn_uint32 IPaddress;
-      vrpn_uint32 port;
-      vrpn_bool grantedLock;
-    };
-
-    peerData * d_peerData;
-      ///< Needed only to clean up when a peer shuts down (mid-request).
-      ///< It isn't currently feasible to have all this data, so instead
-      ///< we abort requests that were interrupted by a shutdown.
-
     vrpn_PeerMutex (const char * name, vrpn_Connection * c);
       ///< This constructor reuses a SERVER connection for the mutex.
       ///< BUG BUG BUG - do not use this constructor;  it does not reliably
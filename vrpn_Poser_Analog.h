@@ -27,6 +27,14 @@
 // and velocities to the client when the requests are within the bounds.  This is not
 // what you want it to do if you've got an independent tracker watching your output,
 // and in any case is open-loop, so use with caution.
+//
+// If it is given an update rate, velocity requests move the pose: it is integrated
+// in fixed steps at that rate, on a schedule kept by the clock rather than by how
+// often mainloop() is called, and the analog outputs (and tracker reports, stamped
+// with the time each step stands for) are updated after each step.  The velocity's
+// vel_quat is taken as a steady rotation, in the world frame, of its angle every
+// vel_quat_dt seconds.  Positions stay within the workspace.  With no update rate,
+// velocity requests are only echoed back.
 
 
 // Class for holding data used in transforming pose data to analog values for each axis
@@ -71,7 +79,8 @@ public:
 
 class VRPN_API vrpn_Poser_Analog : public vrpn_Poser, public vrpn_Tracker {
     public:
-        vrpn_Poser_Analog(const char* name, vrpn_Connection* c, vrpn_Poser_AnalogParam* p, bool act_as_tracker = false);
+        vrpn_Poser_Analog(const char* name, vrpn_Connection* c, vrpn_Poser_AnalogParam* p, bool act_as_tracker = false,
+                          double update_rate = 0.0);
 
         virtual ~vrpn_Poser_Analog();
 
@@ -84,6 +93,18 @@ class VRPN_API vrpn_Poser_Analog : public vrpn_Poser, public vrpn_Tracker {
         // Should we act like a tracker, and report back values?
         bool  d_act_as_tracker;
 
+        // Fixed steps integrating the requested velocity: step n is due at
+        // d_step_base plus n intervals, so rounding does not build up.
+        double          d_update_interval;      // Zero if velocities are not integrated
+        bool            d_moving;
+        struct timeval  d_step_base;
+        double          d_steps;
+        vrpn_float64    d_rot_axis[3];          // Rotation axis and rate (radians/sec)
+        vrpn_float64    d_rot_rate;
+
+        void step_pose(double interval);
+        int report_pose(void);
+
         static int VRPN_CALLBACK handle_change_message(void *userdata, vrpn_HANDLERPARAM p);
         static int VRPN_CALLBACK handle_vel_change_message(void *userdata, vrpn_HANDLERPARAM p);
 
@@ -170,6 +170,32 @@ extern VRPN_API	int vrpn_unbuffer (const char ** buffer, vrpn_float64 * dval);
 extern VRPN_API	int vrpn_unbuffer (const char ** buffer, timeval * t);
 extern VRPN_API	int vrpn_unbuffer (const char ** buffer, char * string, vrpn_int32 length);
 
+// Array versions of the above: buffer or unbuffer count values at once,
+// checking the space left only once.  Advance the pointer and decrease
+// buflen by the whole array; return zero on success and -1 on failure.
+extern VRPN_API	int vrpn_buffer_array (char ** insertPt, vrpn_int32 * buflen, const vrpn_int16 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_buffer_array (char ** insertPt, vrpn_int32 * buflen, const vrpn_uint16 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_buffer_array (char ** insertPt, vrpn_int32 * buflen, const vrpn_int32 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_buffer_array (char ** insertPt, vrpn_int32 * buflen, const vrpn_uint32 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_buffer_array (char ** insertPt, vrpn_int32 * buflen, const vrpn_float32 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_buffer_array (char ** insertPt, vrpn_int32 * buflen, const vrpn_float64 * values, vrpn_uint32 count);
+
+extern VRPN_API	int vrpn_unbuffer_array (const char ** buffer, vrpn_int32 * buflen, vrpn_int16 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_unbuffer_array (const char ** buffer, vrpn_int32 * buflen, vrpn_uint16 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_unbuffer_array (const char ** buffer, vrpn_int32 * buflen, vrpn_int32 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_unbuffer_array (const char ** buffer, vrpn_int32 * buflen, vrpn_uint32 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_unbuffer_array (const char ** buffer, vrpn_int32 * buflen, vrpn_float32 * values, vrpn_uint32 count);
+extern VRPN_API	int vrpn_unbuffer_array (const char ** buffer, vrpn_int32 * buflen, vrpn_float64 * values, vrpn_uint32 count);
+
+// Locale-independent strtod() for parsing text from devices.  Skips
+// leading white space and reads [sign] digits [. digits] [e [sign] digits].
+// Returns a pointer just past the number, or NULL if there isn't one.  The
+// value is exactly what strtod() gives in the "C" locale: up to 15
+// significant digits with an exponent of at most 22 are converted with
+// one correctly-rounded multiply or divide, and anything longer (or hex,
+// inf or nan) is handed to strtod().
+extern VRPN_API	const char * vrpn_parse_double (const char * str, double * d);
+
 // From this we get the variable "vrpn_big_endian" set to true if the machine we are
 // on is big endian and to false if it is little endian.  This can be used by
 // custom packing and unpacking code to bypass the buffer and unbuffer routines
@@ -341,4 +367,114 @@ protected:
 // Returns true if they work and false if they do not.
 extern bool vrpn_test_threads_and_semaphores(void);
 
+// Exchanging and reading a volatile long as one step, so that two threads
+// can hand small values back and forth without a lock.  Where the compiler
+// offers no way to do this, vrpn_ATOMIC_LOCK_FREE is not defined.
+// The _POINTER versions do the same for a volatile pointer (and return a
+// void * that the caller casts back); vrpn_ATOMIC_STORE_POINTER publishes
+// a pointer without returning the old one.
+#if defined(_WIN32) && !defined(__CYGWIN__)
+#  define vrpn_ATOMIC_LOCK_FREE
+#  define vrpn_ATOMIC_EXCHANGE(ptr, val) InterlockedExchange((ptr), (val))
+#  define vrpn_ATOMIC_LOAD(ptr) InterlockedCompareExchange((ptr), 0, 0)
+#  define vrpn_ATOMIC_EXCHANGE_POINTER(ptr, val) \
+     InterlockedExchangePointer((PVOID volatile *)(ptr), (val))
+#  define vrpn_ATOMIC_LOAD_POINTER(ptr) \
+     InterlockedCompareExchangePointer((PVOID volatile *)(ptr), NULL, NULL)
+#  define vrpn_ATOMIC_STORE_POINTER(ptr, val) \
+     ((void)InterlockedExchangePointer((PVOID volatile *)(ptr), (val)))
+#elif defined(__GNUC__)
+#  define vrpn_ATOMIC_LOCK_FREE
+#  define vrpn_ATOMIC_EXCHANGE(ptr, val) __atomic_exchange_n((ptr), (val), __ATOMIC_ACQ_REL)
+#  define vrpn_ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#  define vrpn_ATOMIC_EXCHANGE_POINTER(ptr, val) \
+     ((void *)__atomic_exchange_n((ptr), (val), __ATOMIC_ACQ_REL))
+#  define vrpn_ATOMIC_LOAD_POINTER(ptr) ((void *)__atomic_load_n((ptr), __ATOMIC_ACQUIRE))
+#  define vrpn_ATOMIC_STORE_POINTER(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#endif
+
+// The indices of a triple buffer, which hands the latest value of something
+// from one thread to one other without either of them waiting.  The caller
+// keeps three slots, each of which belongs to one thread at a time: the
+// writer fills write_slot() and publishes it, swapping it for the one last
+// published; the reader calls acquire() to swap read_slot() for that one if
+// it is newer, and then reads read_slot().  Where there is no lock-free
+// exchange, a semaphore guards the swaps.
+class VRPN_API vrpn_Triple_Buffer {
+public:
+  vrpn_Triple_Buffer() : d_published(0), d_write(1), d_read(2) { }
+
+  // Called by the writing thread only.
+  int write_slot() const { return d_write; }
+  void publish();
+
+  // Called by the reading thread only.  acquire() returns true if a slot
+  // was published since the last time it was called.
+  bool acquire();
+  int read_slot() const { return d_read; }
+
+protected:
+  enum { SLOT = 3, FRESH = 4 };
+  long exchange(long val);
+  long load();
+
+#ifndef vrpn_ATOMIC_LOCK_FREE
+  vrpn_Semaphore d_lock;
+#endif
+  volatile long d_published;  // Slot last published, and whether it is new
+  long d_write;               // Slot the writer fills next
+  long d_read;                // Slot the reader has
+};
+
+// A queue that any number of threads can push onto and one thread pops
+// from, without any of them waiting on the others (except where there is
+// no lock-free exchange, where a semaphore guards it).  Items derive from
+// vrpn_Queue_Node; the queue links them but does not own them, so pop()
+// hands each back to be deleted by the caller.  Items come off in the order
+// they went on from each thread.
+struct vrpn_Queue_Node {
+  vrpn_Queue_Node * volatile next;
+};
+
+class VRPN_API vrpn_MPSC_Queue {
+public:
+  vrpn_MPSC_Queue();
+
+  // Called by any thread.
+  void push(vrpn_Queue_Node *node);
+
+  // Called by the popping thread only.  Returns NULL if the queue is empty
+  // (or if the only item on it is still being pushed).
+  vrpn_Queue_Node *pop();
+
+protected:
+  vrpn_Queue_Node d_stub;             // Keeps the queue from ever being empty
+  vrpn_Queue_Node * volatile d_head;  // Last item pushed
+  vrpn_Queue_Node *d_tail;            // Next item to pop (or the stub)
+#ifndef vrpn_ATOMIC_LOCK_FREE
+  vrpn_Semaphore d_lock;
+#endif
+
+private:
+  vrpn_MPSC_Queue(const vrpn_MPSC_Queue &);
+  vrpn_MPSC_Queue &operator=(const vrpn_MPSC_Queue &);
+};
+
+// A lock that lets several threads run VRPN code one at a time, passing it
+// on whenever the one holding it waits on a device.  While it is set, every
+// thread that calls into VRPN must hold it; vrpn_SleepMsecs() and the waits
+// in vrpn_Serial let go of it while they wait, if the calling thread holds
+// it.  This makes it safe to open and reset devices on other threads even
+// though the rest of VRPN is not thread-safe (vrpn_Generic_Server_Object
+// does this).  Set it to NULL when the other threads are done.
+extern VRPN_API	void vrpn_set_device_wait_lock(vrpn_Semaphore *lock);
+extern VRPN_API	vrpn_Semaphore *vrpn_device_wait_lock(void);
+extern VRPN_API	void vrpn_acquire_device_wait_lock(void);
+// Returns true if the calling thread held the lock (and now does not).
+extern VRPN_API	bool vrpn_release_device_wait_lock(void);
+// If the calling thread holds the lock and others are waiting for it, lets
+// one of them have it and then takes it back.  A thread that holds it and
+// might not wait on anything calls this now and then.
+extern VRPN_API	void vrpn_yield_device_wait_lock(void);
+
 #endif  // VRPN_SHARED_H
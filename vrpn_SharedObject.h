@@ -23,6 +23,7 @@ class VRPN_API vrpn_LamportTimestamp;
 class VRPN_API vrpn_Shared_int32;
 class VRPN_API vrpn_Shared_float64;
 class VRPN_API vrpn_Shared_String;
+class VRPN_API vrpn_SharedObjectGroup;
 
 typedef int (VRPN_CALLBACK * vrpnDeferredUpdateCallback) (void * userdata);
 
@@ -62,6 +63,13 @@ typedef int (VRPN_CALLBACK * vrpnSharedStringSerializerPolicy)
 // Policy callbacks should return 0 if the update should be accepted,
 // nonzero if it should be denied.
 
+typedef int (VRPN_CALLBACK * vrpnSharedGroupCallback)
+                    (void * userdata, timeval when);
+
+// Group callbacks are called once for each group update received from
+// a peer, after every value in it has been set and the callbacks on the
+// individual objects have been triggered.
+
 #define VRPN_SO_DEFAULT 0x00
 #define VRPN_SO_IGNORE_IDEMPOTENT 0x01
 #define VRPN_SO_DEFER_UPDATES 0x10
@@ -109,6 +117,8 @@ enum vrpn_SerializerPolicy { vrpn_ACCEPT, vrpn_DENY_REMOTE,
 
 class VRPN_API vrpn_SharedObject {
 
+  friend class vrpn_SharedObjectGroup;
+
   public:
 
     vrpn_SharedObject (const char * name, const char * tname,
@@ -231,6 +241,34 @@ class VRPN_API vrpn_SharedObject {
       ///< Passes arguments to handleUpdate() for this type;
       ///< registered in postBindCleanup();
 
+    // vrpn_SharedObjectGroup support
+
+    vrpn_SharedObjectGroup * d_group;
+    vrpn_int32 d_groupIndex;
+    vrpn_bool d_groupDirty;
+      ///< Already queued for the group's next update message.
+    vrpn_bool d_groupApplying;
+    vrpn_bool d_groupCallbacksPending;
+
+    void queueGroupUpdate (timeval when);
+      ///< Called by sendUpdate() instead of sending a message if we're
+      ///< in a group;  the group will send the value in d_groupValue.
+    vrpn_bool deferCallbacks (void);
+      ///< Called before yankCallbacks() when a set() is accepted;
+      ///< returns TRUE (and remembers to yank them later) if the set()
+      ///< is part of a group update that hasn't been fully applied.
+
+    virtual vrpn_int32 groupEntrySize (void) const;
+      ///< Bytes encodeGroupEntry() will write, or -1 if this type
+      ///< can't be put in a group.
+    virtual void encodeGroupEntry (char ** buffer, vrpn_int32 * len) const;
+      ///< Encodes the value most recently passed to sendUpdate().
+    virtual int decodeGroupEntry (const char ** buffer, vrpn_int32 * len);
+      ///< Decodes a value without applying it;  -1 if it's truncated.
+    virtual void applyGroupEntry (timeval when);
+      ///< set()s the value decoded by decodeGroupEntry().
+    virtual int yankGroupCallbacks (void);
+
   private:
 
     void postBindCleanup (void);
@@ -298,6 +336,15 @@ class VRPN_API vrpn_Shared_int32 : public vrpn_SharedObject {
                              vrpn_bool isLocalSet, 
                              vrpn_LamportTimestamp * = NULL);
 
+    vrpn_int32 d_groupValue;
+    vrpn_int32 d_groupReceived;
+
+    virtual vrpn_int32 groupEntrySize (void) const;
+    virtual void encodeGroupEntry (char ** buffer, vrpn_int32 * len) const;
+    virtual int decodeGroupEntry (const char ** buffer, vrpn_int32 * len);
+    virtual void applyGroupEntry (timeval when);
+    virtual int yankGroupCallbacks (void);
+
     virtual vrpn_bool shouldAcceptUpdate (vrpn_int32 newValue, timeval when,
                                           vrpn_bool isLocalSet, 
                                           vrpn_LamportTimestamp *);
@@ -437,6 +484,15 @@ class VRPN_API vrpn_Shared_float64 : public vrpn_SharedObject {
 
     vrpn_Shared_float64 & set (vrpn_float64, timeval, vrpn_bool isLocalSet);
 
+    vrpn_float64 d_groupValue;
+    vrpn_float64 d_groupReceived;
+
+    virtual vrpn_int32 groupEntrySize (void) const;
+    virtual void encodeGroupEntry (char ** buffer, vrpn_int32 * len) const;
+    virtual int decodeGroupEntry (const char ** buffer, vrpn_int32 * len);
+    virtual void applyGroupEntry (timeval when);
+    virtual int yankGroupCallbacks (void);
+
     virtual vrpn_bool shouldAcceptUpdate (vrpn_float64 newValue, timeval when,
                                           vrpn_bool isLocalSet);
 
@@ -556,6 +612,15 @@ class VRPN_API vrpn_Shared_String : public vrpn_SharedObject {
     vrpn_Shared_String & set (const char *, timeval,
                              vrpn_bool isLocalSet);
 
+    char * d_groupValue;
+    char * d_groupReceived;
+
+    virtual vrpn_int32 groupEntrySize (void) const;
+    virtual void encodeGroupEntry (char ** buffer, vrpn_int32 * len) const;
+    virtual int decodeGroupEntry (const char ** buffer, vrpn_int32 * len);
+    virtual void applyGroupEntry (timeval when);
+    virtual int yankGroupCallbacks (void);
+
     virtual vrpn_bool shouldAcceptUpdate (const char * newValue, timeval when,
                                     vrpn_bool isLocalSet);
 
@@ -610,5 +675,136 @@ class VRPN_API vrpn_Shared_String_Remote : public vrpn_Shared_String {
 
 
 
+
+
+// vrpn_SharedObjectGroup
+//
+//   Sending every set() of every shared object as its own message, each
+// with its own header and timestamp, swamps the connection when an
+// application shares hundreds of values that change every frame.  A group
+// collects the objects that change between calls to its mainloop() and
+// sends them all in one update message:  one timestamp for the whole group
+// (the latest of the changes in it) followed by the index and new value of
+// each object that changed.  The receiving group sets every value in the
+// message before triggering any of the objects' callbacks, and then
+// triggers its own callbacks, so the application never sees half a frame.
+// Frames too large for one message are split, and the receiver waits for
+// the last part before applying any of it.
+//
+//   Objects are identified by their position in the group, so every
+// instance of the group must add() the same objects in the same order.
+// Objects in a group need not be bound to a connection at all;  the group
+// sends and receives for them, and a server group sends every member's
+// value when a new connection is made.  This matters for large groups,
+// because each bound shared object uses two of the connection's
+// vrpn_CONNECTION_MAX_SENDERS.  A member that is bound (to the group's
+// connection) sends no update messages of its own, but still accepts them
+// from peers that don't use groups.  Changes to a member that go out over
+// the network wait for the group's next mainloop().
+
+class VRPN_API vrpn_SharedObjectGroup {
+
+  friend class vrpn_SharedObject;
+
+  public:
+
+    vrpn_SharedObjectGroup (const char * name);
+    virtual ~vrpn_SharedObjectGroup (void);
+
+    // ACCESSORS
+
+    const char * name (void) const;
+    int numMembers (void) const;
+
+    // MANIPULATORS
+
+    virtual void bindConnection (vrpn_Connection *);
+
+    int add (vrpn_SharedObject *);
+      ///< Appends an object to the group.  Returns -1 if it is already
+      ///< in a group, the group is full, or its type can't be grouped.
+    void remove (vrpn_SharedObject *);
+      ///< Leaves a hole so that the other objects keep their positions.
+      ///< Called by the object's destructor.
+
+    void mainloop (void);
+      ///< Sends the changes made since the last call.  Call once a frame.
+
+    void register_handler (vrpnSharedGroupCallback, void *);
+    void unregister_handler (vrpnSharedGroupCallback, void *);
+
+  protected:
+
+    char * d_name;
+    vrpn_Connection * d_connection;
+
+    vrpn_int32 d_serverId;
+    vrpn_int32 d_remoteId;
+    vrpn_int32 d_myId;
+    vrpn_int32 d_peerId;
+    vrpn_int32 d_groupUpdate_type;
+
+    vrpn_SharedObject ** d_members;
+    vrpn_int32 d_numMembers;
+    vrpn_int32 d_membersAllocated;
+
+    vrpn_int32 * d_dirty;
+      ///< Indices of members to send;  as large as d_members.
+    vrpn_int32 d_numDirty;
+    timeval d_dirtyWhen;
+      ///< Latest timestamp of the queued changes.
+    vrpn_int32 * d_received;
+      ///< Indices of members in the frame being applied.
+
+    char * d_staged;
+      ///< Entries received from the parts of a split frame so far.
+    vrpn_int32 d_stagedLen;
+    vrpn_int32 d_stagedAllocated;
+    vrpn_int32 d_stagedEntries;
+
+    struct callbackEntry {
+      vrpnSharedGroupCallback handler;
+      void * userdata;
+      callbackEntry * next;
+    };
+    callbackEntry * d_callbacks;
+
+    void markDirty (vrpn_SharedObject *, timeval when);
+
+    void sendPart (char * buffer, vrpn_int32 len, vrpn_int32 numEntries,
+                   vrpn_bool last);
+    int stage (const char * entries, vrpn_int32 len, vrpn_int32 numEntries);
+    int applyStaged (timeval when);
+
+    void serverPostBindCleanup (void);
+    void remotePostBindCleanup (void);
+
+    static int VRPN_CALLBACK handle_groupUpdate (void *, vrpn_HANDLERPARAM);
+    static int VRPN_CALLBACK handle_gotConnection (void *, vrpn_HANDLERPARAM);
+      ///< Registered by serverPostBindCleanup();  sends every member.
+};
+
+class VRPN_API vrpn_SharedObjectGroup_Server : public vrpn_SharedObjectGroup {
+
+  public:
+
+    vrpn_SharedObjectGroup_Server (const char * name);
+    virtual ~vrpn_SharedObjectGroup_Server (void);
+
+    virtual void bindConnection (vrpn_Connection *);
+};
+
+class VRPN_API vrpn_SharedObjectGroup_Remote : public vrpn_SharedObjectGroup {
+
+  public:
+
+    vrpn_SharedObjectGroup_Remote (const char * name);
+    virtual ~vrpn_SharedObjectGroup_Remote (void);
+
+    virtual void bindConnection (vrpn_Connection *);
+};
+
+
+
 #endif  // VRPN_SHARED_OBJECT
 
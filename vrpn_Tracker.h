@@ -54,6 +54,15 @@ const	int vrpn_ALL_SENSORS = -1;
 typedef vrpn_float64  vrpn_Tracker_Pos[3];
 typedef vrpn_float64  vrpn_Tracker_Quat[4];
 
+// Most sensors whose poses go in one frame message.  Larger frames are
+// sent as several messages, so that each fits in a UDP packet.
+const	int vrpn_TRACKER_FRAME_SENSORS = 20;
+
+// Most sensors a vrpn_Tracker_Sensor_Table holds.  Sensor numbers come off
+// the network, so the table leaves out reports for sensors past this
+// rather than growing (and being copied) without bound.
+const	int vrpn_TRACKER_MAX_SENSORS = 4096;
+
 class VRPN_API vrpn_Tracker : public vrpn_BaseClass {
   public:
   // vrpn_Tracker.cfg, in the "local" directory, is the default config file
@@ -92,6 +101,8 @@ class VRPN_API vrpn_Tracker : public vrpn_BaseClass {
    vrpn_int32 update_rate_id;		// ID of update rate message
    vrpn_int32 connection_dropped_m_id;	// ID of connection dropped message
    vrpn_int32 reset_origin_m_id;	// ID of reset origin message					
+   vrpn_int32 frame_m_id;		// ID of tracker frame message
+   vrpn_int32 request_frames_m_id;	// ID of request for frame messages
 
    // Description of the next report to go out
    vrpn_int32 d_sensor;			// Current sensor
@@ -138,6 +149,39 @@ class VRPN_API vrpn_Tracker : public vrpn_BaseClass {
    virtual int encode_tracker2room_to(char *buf); // Encodes the tracker2room
    virtual int encode_unit2sensor_to(char *buf); // and unit2sensor xforms
    virtual int encode_workspace_to(char *buf); // Encodes workspace info
+
+   // A tracker that samples all of its sensors at the same time can send
+   // each frame's poses in one message (or a few, for many sensors) to the
+   // clients that ask for frames, rather than one message per sensor.  It
+   // calls register_frame_handlers() when it is built, and then for each
+   // frame fills in d_sensor, pos and d_quat (or whatever else its
+   // encode_to() sends) and calls add_to_frame() for each sensor, then
+   // calls send_frame().  Clients that did not ask for frames, including
+   // those built before there were frames, get a message per sensor as
+   // before.  Each returns 0 on success and -1 on failure.
+   int register_frame_handlers(void);
+   int add_to_frame(const struct timeval t,
+		    vrpn_uint32 class_of_service = vrpn_CONNECTION_LOW_LATENCY);
+   int send_frame(const struct timeval t,
+		  vrpn_uint32 class_of_service = vrpn_CONNECTION_LOW_LATENCY);
+
+   // Frames come from a sender named after the tracker, registered when
+   // a client first asks for them.  The connection sends its messages
+   // only to the clients that asked, once the first frame goes out.
+   vrpn_int32 d_frame_sender_id;
+   bool d_frames_targeted;
+   int frame_sender_name(cName name);	// Returns -1 if it won't fit
+
+   // The part of the current frame that has not been sent yet.  The poses
+   // are kept as encode_to() put them into the message for each sensor.
+   vrpn_int32 d_frame_sensors[vrpn_TRACKER_FRAME_SENSORS];
+   char d_frame_poses[vrpn_TRACKER_FRAME_SENSORS * 7 * sizeof(vrpn_float64)];
+   int d_frame_len;
+   int d_frame_parts;			// Messages of it sent so far
+   int send_frame_part(const struct timeval t, bool more,
+		       vrpn_uint32 class_of_service);
+
+   static int VRPN_CALLBACK handle_frames_request(void *userdata, vrpn_HANDLERPARAM p);
 };
 
 #ifndef VRPN_CLIENT_ONLY
@@ -271,6 +315,13 @@ class VRPN_API vrpn_Tracker_Server: public vrpn_Tracker {
 			   const vrpn_float64 interval,
 			   const vrpn_uint32 class_of_service = vrpn_CONNECTION_LOW_LATENCY);
 
+   /// Reports the poses of several sensors, all sampled at time t, as one
+   /// frame.  Clients that asked for frames get them in a frame message.
+   virtual int report_frame(const struct timeval t, const int num,
+			   const vrpn_int32 sensors[],
+			   const vrpn_float64 positions[][3],
+			   const vrpn_float64 quaternions[][4],
+			   const vrpn_uint32 class_of_service = vrpn_CONNECTION_LOW_LATENCY);
 };
 
 
@@ -348,6 +399,21 @@ typedef struct _vrpn_TRACKERWORKSPACECB {
 typedef void (VRPN_CALLBACK *vrpn_TRACKERWORKSPACECHANGEHANDLER)(void *userdata,
 					const vrpn_TRACKERWORKSPACECB info);
 
+// User routine to handle a whole frame of poses, from a tracker that sends
+// them together.  The pose of each sensor in the frame is also passed to
+// the position change handlers, before this is called.  The arrays are
+// only good until the handler returns.
+
+typedef struct _vrpn_TRACKERFRAMECB {
+	struct timeval	msg_time;	// Time of the frame
+	vrpn_int32	num_sensors;	// How many sensors it has poses for
+	const vrpn_int32	*sensors;	// Which sensors those are
+	const vrpn_Tracker_Pos	*pos;	// Position of each
+	const vrpn_Tracker_Quat	*quat;	// Orientation of each
+} vrpn_TRACKERFRAMECB;
+typedef void (VRPN_CALLBACK *vrpn_TRACKERFRAMEHANDLER)(void *userdata,
+					const vrpn_TRACKERFRAMECB info);
+
 // Structure to hold all of the callback lists for one sensor
 // (also used for the "all sensors" sensor).
 class vrpn_Tracker_Sensor_Callbacks {
@@ -366,6 +432,41 @@ public:
     };
 };
 
+// The latest state of each of a tracker's sensors, as its reports arrive:
+// one array per field, indexed by sensor, so that a field can be walked or
+// copied for every sensor at once.  Sensors that have not sent a report of
+// some kind have a zero time for it.
+class VRPN_API vrpn_Tracker_Sensor_Table {
+  public:
+    vrpn_Tracker_Sensor_Table (void);
+    ~vrpn_Tracker_Sensor_Table (void);
+
+    // Makes room for sensors up to and including sensor, which starts out
+    // as not having reported.  Returns false if sensor is negative or not
+    // below vrpn_TRACKER_MAX_SENSORS, or if out of memory.
+    bool ensure_enough (vrpn_int32 sensor);
+
+    // Makes this a copy of from.  Returns false if out of memory.
+    bool copy_from (const vrpn_Tracker_Sensor_Table & from);
+
+    unsigned		num_sensors;	// One more than the highest sensor reported
+    vrpn_Tracker_Pos	*pos;		// Position of each sensor
+    vrpn_Tracker_Quat	*quat;		// Orientation of each sensor
+    struct timeval	*pose_time;	// Time of each sensor's last pose
+    vrpn_Tracker_Pos	*vel;		// Velocity of each sensor
+    vrpn_Tracker_Quat	*vel_quat;	// Future orientation of each sensor
+    vrpn_float64	*vel_quat_dt;	// Delta time (in secs) for vel_quat
+    struct timeval	*vel_time;	// Time of each sensor's last velocity
+
+  protected:
+    unsigned d_max;			// Room in the arrays
+
+  private:
+    // Copy with copy_from(), which can report running out of memory.
+    vrpn_Tracker_Sensor_Table (const vrpn_Tracker_Sensor_Table &);
+    vrpn_Tracker_Sensor_Table & operator = (const vrpn_Tracker_Sensor_Table &);
+};
+
 // Open a tracker that is on the other end of a connection
 // and handle updates from it.  This is the type of tracker that user code will
 // deal with.
@@ -448,6 +549,28 @@ class VRPN_API vrpn_Tracker_Remote: public vrpn_Tracker {
 	  return d_tracker2roomchange_list.unregister_handler(userdata, handler);
 	};
 
+	// **** to get whole frames of poses ****
+	// (un)Register a callback handler to handle a frame
+	virtual int register_change_handler(void *userdata,
+		vrpn_TRACKERFRAMEHANDLER handler) {
+	  return d_framechange_list.register_handler(userdata, handler);
+	};
+	virtual int unregister_change_handler(void *userdata,
+		vrpn_TRACKERFRAMEHANDLER handler) {
+	  return d_framechange_list.unregister_handler(userdata, handler);
+	};
+
+	// **** to get the latest state of every sensor ****
+	// The table is kept up to date as reports arrive, without any
+	// handlers needing to be registered.  sensor_table() is the table
+	// itself, for use on the thread that calls mainloop().
+	// get_sensor_table() fills in a copy of it as it stood the last time
+	// mainloop() returned, and may be called from one other thread (a
+	// renderer, say) while mainloop() runs, without either waiting on the
+	// other.  It returns true if the copy has changed since the last call.
+	const vrpn_Tracker_Sensor_Table &sensor_table(void) const { return d_sensor_table; }
+	bool get_sensor_table(vrpn_Tracker_Sensor_Table &table);
+
   protected:
     // Callbacks with one per sensor (plus one for "all")
     vrpn_Tracker_Sensor_Callbacks   all_sensor_callbacks;
@@ -458,6 +581,31 @@ class VRPN_API vrpn_Tracker_Remote: public vrpn_Tracker {
     // Callbacks that are one per tracker
     vrpn_Callback_List<vrpn_TRACKERTRACKER2ROOMCB>  d_tracker2roomchange_list;
     vrpn_Callback_List<vrpn_TRACKERWORKSPACECB>	    d_workspacechange_list;
+    vrpn_Callback_List<vrpn_TRACKERFRAMECB>	    d_framechange_list;
+
+    // Frames come from the tracker's frame sender, which the server sends
+    // only to clients that asked;  we ask whenever we connect to it.  A
+    // server's log file holds the message for each sensor as well, so a
+    // frame is skipped when the message for each sensor came at its time.
+    struct timeval d_last_pose_time;
+    int send_frames_request(void);
+
+    // The frame being put together from its messages.
+    struct timeval	d_frame_in_time;
+    vrpn_int32		*d_frame_in_sensors;
+    vrpn_Tracker_Pos	*d_frame_in_pos;
+    vrpn_Tracker_Quat	*d_frame_in_quat;
+    unsigned d_frame_in_len;
+    unsigned d_frame_in_max;
+    bool  ensure_enough_frame_poses(unsigned num);
+
+    // The latest state of every sensor, and the copies of it handed to
+    // get_sensor_table() through a triple buffer.
+    vrpn_Tracker_Sensor_Table	d_sensor_table;
+    bool			d_sensor_table_changed;
+    vrpn_Tracker_Sensor_Table	d_sensor_table_slots[3];
+    vrpn_Triple_Buffer		d_sensor_table_index;
+    void publish_sensor_table(void);
 
     static int VRPN_CALLBACK handle_change_message(void *userdata,
 		    vrpn_HANDLERPARAM p);
@@ -471,6 +619,10 @@ class VRPN_API vrpn_Tracker_Remote: public vrpn_Tracker {
                     vrpn_HANDLERPARAM p);
     static int VRPN_CALLBACK handle_workspace_change_message(void *userdata,
 		    vrpn_HANDLERPARAM p);
+    static int VRPN_CALLBACK handle_frame_message(void *userdata,
+		    vrpn_HANDLERPARAM p);
+    static int VRPN_CALLBACK handle_got_connection_message(void *userdata,
+		    vrpn_HANDLERPARAM p);
 };
 
 // End of vrpn_TRACKER_H
@@ -103,12 +103,23 @@ public:
 // world frame, rather than the local frame. Useful for a simulated wand
 // when doing desktop testing of immersive apps - easier to keep under control.
 
+// If fixedStep is TRUE, reports are sent at a steady update_rate, on a
+// schedule kept by the clock rather than by how often mainloop() is called,
+// and each is stamped with the time it stands for.  A differential tracker
+// holds the latest value from each analog and integrates it over exactly one
+// report interval per report, keeping its pose as a position and a
+// quaternion; the rotation rates are taken together as one angular velocity
+// rather than as Euler angles applied one after the other, so a steady turn
+// stays on its arc however long the interval.  If mainloop() is held up for
+// more than a second, the time past that is integrated without reports.
+
 class VRPN_API vrpn_Tracker_AnalogFly : public vrpn_Tracker {
   public:
     vrpn_Tracker_AnalogFly (const char * name, vrpn_Connection * trackercon,
 			    vrpn_Tracker_AnalogFlyParam * params,
                             float update_rate, bool absolute = vrpn_FALSE,
-                            bool reportChanges = VRPN_FALSE, bool worldFrame = VRPN_FALSE);
+                            bool reportChanges = VRPN_FALSE, bool worldFrame = VRPN_FALSE,
+                            bool fixedStep = VRPN_FALSE);
 
     virtual ~vrpn_Tracker_AnalogFly (void);
 
@@ -127,6 +138,14 @@ class VRPN_API vrpn_Tracker_AnalogFly : public vrpn_Tracker {
     bool	    d_absolute;		//< Report absolute (vs. differential)?
     bool       d_reportChanges;
     bool       d_worldFrame;
+    bool       d_fixedStep;
+
+    // Fixed-step schedule: report d_steps is due at d_step_base plus that
+    // many intervals, so rounding does not build up.
+    struct timeval  d_step_base;
+    double          d_steps;
+    q_vec_type      d_step_pos;		//< Pose integrated in fixed steps
+    q_type          d_step_quat;
 
     vrpn_TAF_fullaxis	d_x, d_y, d_z, d_sx, d_sy, d_sz;
     vrpn_Button_Remote	* d_reset_button;
@@ -140,6 +159,9 @@ class VRPN_API vrpn_Tracker_AnalogFly : public vrpn_Tracker {
 
     void    update_matrix_based_on_values (double time_interval);
     void    convert_matrix_to_tracker (void);
+    void    step_pose (double time_interval);
+    void    fixed_step_mainloop (const struct timeval & now);
+    void    send_report (void);
 
     bool shouldReport (double elapsedInterval) const;
 
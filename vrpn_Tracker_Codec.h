@@ -0,0 +1,480 @@
+#ifndef VRPN_TRACKER_CODEC_H
+#define VRPN_TRACKER_CODEC_H
+//Warning: this file automatically generated using the command line
+// util/gen_rpc/gen_vrpn_rpc.pl -t vrpn_Tracker.vrpndef
+//DO NOT EDIT! Edit the source file instead.
+
+#include "vrpn_BufferUtils.h"
+
+class vrpn_Tracker_Codec {
+  public:
+
+  struct Pos_Quat {
+    vrpn_int32 sensor;
+    vrpn_int32 padding;
+    vrpn_float64 pos [3];
+    vrpn_float64 quat [4];
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_float64>::value * 3
+      + vrpn_codec::wire_size<vrpn_float64>::value * 4 };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, sensor);
+      vrpn_codec::put(&buf, padding);
+      vrpn_codec::put_array(&buf, &pos[0], 3);
+      vrpn_codec::put_array(&buf, &quat[0], 4);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &sensor);
+      vrpn_codec::get(&buf, &padding);
+      vrpn_codec::get_array(&buf, &pos[0], 3);
+      vrpn_codec::get_array(&buf, &quat[0], 4);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_sensor(NULL), d_padding(NULL), d_pos(NULL), d_quat(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_sensor = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_padding = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_pos = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 3;
+          d_quat = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 4;
+          return fixed_size;
+        }
+
+        vrpn_int32 sensor (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_sensor);
+        }
+        vrpn_int32 padding (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_padding);
+        }
+        vrpn_codec::array<vrpn_float64> pos (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_pos, 3);
+        }
+        vrpn_codec::array<vrpn_float64> quat (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_quat, 4);
+        }
+
+      private:
+        const char * d_sensor;
+        const char * d_padding;
+        const char * d_pos;
+        const char * d_quat;
+    };
+  };
+
+  struct Velocity {
+    vrpn_int32 sensor;
+    vrpn_int32 padding;
+    vrpn_float64 vel [3];
+    vrpn_float64 vel_quat [4];
+    vrpn_float64 vel_quat_dt;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_float64>::value * 3
+      + vrpn_codec::wire_size<vrpn_float64>::value * 4
+      + vrpn_codec::wire_size<vrpn_float64>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, sensor);
+      vrpn_codec::put(&buf, padding);
+      vrpn_codec::put_array(&buf, &vel[0], 3);
+      vrpn_codec::put_array(&buf, &vel_quat[0], 4);
+      vrpn_codec::put(&buf, vel_quat_dt);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &sensor);
+      vrpn_codec::get(&buf, &padding);
+      vrpn_codec::get_array(&buf, &vel[0], 3);
+      vrpn_codec::get_array(&buf, &vel_quat[0], 4);
+      vrpn_codec::get(&buf, &vel_quat_dt);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_sensor(NULL), d_padding(NULL), d_vel(NULL), d_vel_quat(NULL), d_vel_quat_dt(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_sensor = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_padding = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_vel = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 3;
+          d_vel_quat = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 4;
+          d_vel_quat_dt = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value;
+          return fixed_size;
+        }
+
+        vrpn_int32 sensor (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_sensor);
+        }
+        vrpn_int32 padding (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_padding);
+        }
+        vrpn_codec::array<vrpn_float64> vel (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_vel, 3);
+        }
+        vrpn_codec::array<vrpn_float64> vel_quat (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_vel_quat, 4);
+        }
+        vrpn_float64 vel_quat_dt (void) const {
+          return vrpn_codec::read<vrpn_float64>(d_vel_quat_dt);
+        }
+
+      private:
+        const char * d_sensor;
+        const char * d_padding;
+        const char * d_vel;
+        const char * d_vel_quat;
+        const char * d_vel_quat_dt;
+    };
+  };
+
+  struct Acceleration {
+    vrpn_int32 sensor;
+    vrpn_int32 padding;
+    vrpn_float64 acc [3];
+    vrpn_float64 acc_quat [4];
+    vrpn_float64 acc_quat_dt;
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_float64>::value * 3
+      + vrpn_codec::wire_size<vrpn_float64>::value * 4
+      + vrpn_codec::wire_size<vrpn_float64>::value };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, sensor);
+      vrpn_codec::put(&buf, padding);
+      vrpn_codec::put_array(&buf, &acc[0], 3);
+      vrpn_codec::put_array(&buf, &acc_quat[0], 4);
+      vrpn_codec::put(&buf, acc_quat_dt);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &sensor);
+      vrpn_codec::get(&buf, &padding);
+      vrpn_codec::get_array(&buf, &acc[0], 3);
+      vrpn_codec::get_array(&buf, &acc_quat[0], 4);
+      vrpn_codec::get(&buf, &acc_quat_dt);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_sensor(NULL), d_padding(NULL), d_acc(NULL), d_acc_quat(NULL), d_acc_quat_dt(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_sensor = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_padding = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_acc = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 3;
+          d_acc_quat = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 4;
+          d_acc_quat_dt = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value;
+          return fixed_size;
+        }
+
+        vrpn_int32 sensor (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_sensor);
+        }
+        vrpn_int32 padding (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_padding);
+        }
+        vrpn_codec::array<vrpn_float64> acc (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_acc, 3);
+        }
+        vrpn_codec::array<vrpn_float64> acc_quat (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_acc_quat, 4);
+        }
+        vrpn_float64 acc_quat_dt (void) const {
+          return vrpn_codec::read<vrpn_float64>(d_acc_quat_dt);
+        }
+
+      private:
+        const char * d_sensor;
+        const char * d_padding;
+        const char * d_acc;
+        const char * d_acc_quat;
+        const char * d_acc_quat_dt;
+    };
+  };
+
+  struct To_Room {
+    vrpn_float64 pos [3];
+    vrpn_float64 quat [4];
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_float64>::value * 3
+      + vrpn_codec::wire_size<vrpn_float64>::value * 4 };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put_array(&buf, &pos[0], 3);
+      vrpn_codec::put_array(&buf, &quat[0], 4);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get_array(&buf, &pos[0], 3);
+      vrpn_codec::get_array(&buf, &quat[0], 4);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_pos(NULL), d_quat(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_pos = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 3;
+          d_quat = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 4;
+          return fixed_size;
+        }
+
+        vrpn_codec::array<vrpn_float64> pos (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_pos, 3);
+        }
+        vrpn_codec::array<vrpn_float64> quat (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_quat, 4);
+        }
+
+      private:
+        const char * d_pos;
+        const char * d_quat;
+    };
+  };
+
+  struct Unit_To_Sensor {
+    vrpn_int32 sensor;
+    vrpn_int32 padding;
+    vrpn_float64 pos [3];
+    vrpn_float64 quat [4];
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_int32>::value
+      + vrpn_codec::wire_size<vrpn_float64>::value * 3
+      + vrpn_codec::wire_size<vrpn_float64>::value * 4 };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put(&buf, sensor);
+      vrpn_codec::put(&buf, padding);
+      vrpn_codec::put_array(&buf, &pos[0], 3);
+      vrpn_codec::put_array(&buf, &quat[0], 4);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get(&buf, &sensor);
+      vrpn_codec::get(&buf, &padding);
+      vrpn_codec::get_array(&buf, &pos[0], 3);
+      vrpn_codec::get_array(&buf, &quat[0], 4);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_sensor(NULL), d_padding(NULL), d_pos(NULL), d_quat(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_sensor = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_padding = buf;
+          buf += vrpn_codec::wire_size<vrpn_int32>::value;
+          d_pos = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 3;
+          d_quat = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 4;
+          return fixed_size;
+        }
+
+        vrpn_int32 sensor (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_sensor);
+        }
+        vrpn_int32 padding (void) const {
+          return vrpn_codec::read<vrpn_int32>(d_padding);
+        }
+        vrpn_codec::array<vrpn_float64> pos (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_pos, 3);
+        }
+        vrpn_codec::array<vrpn_float64> quat (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_quat, 4);
+        }
+
+      private:
+        const char * d_sensor;
+        const char * d_padding;
+        const char * d_pos;
+        const char * d_quat;
+    };
+  };
+
+  struct Workspace {
+    vrpn_float64 min [3];
+    vrpn_float64 max [3];
+
+    // Bytes taken by the fields whose size does not depend on a count.
+    enum { fixed_size = vrpn_codec::wire_size<vrpn_float64>::value * 3
+      + vrpn_codec::wire_size<vrpn_float64>::value * 3 };
+
+    // Bytes the message takes on the wire.
+    vrpn_uint32 size (void) const {
+      return fixed_size;
+    }
+
+    // Encodes the message into buf, which has room for buflen bytes.
+    // Returns the number of bytes used, or -1 if they do not fit.
+    int encode (char * buf, vrpn_uint32 buflen) const {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::put_array(&buf, &min[0], 3);
+      vrpn_codec::put_array(&buf, &max[0], 3);
+      return fixed_size;
+    }
+
+    // Decodes the message from buf, which holds buflen bytes.
+    // Returns the number of bytes read, or -1 if the message is short.
+    int decode (const char * buf, vrpn_uint32 buflen) {
+      if (buflen < fixed_size) return -1;
+      vrpn_codec::get_array(&buf, &min[0], 3);
+      vrpn_codec::get_array(&buf, &max[0], 3);
+      return fixed_size;
+    }
+
+    // Reads the message in place from a received buffer, converting
+    // each value as it is asked for.
+    class View {
+      public:
+        View (void) : d_min(NULL), d_max(NULL) {}
+
+        // Points the view at buf, which holds buflen bytes.  Returns
+        // the number of bytes the message takes, or -1 if it is short.
+        int attach (const char * buf, vrpn_uint32 buflen) {
+          if (buflen < fixed_size) return -1;
+          d_min = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 3;
+          d_max = buf;
+          buf += vrpn_codec::wire_size<vrpn_float64>::value * 3;
+          return fixed_size;
+        }
+
+        vrpn_codec::array<vrpn_float64> min (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_min, 3);
+        }
+        vrpn_codec::array<vrpn_float64> max (void) const {
+          return vrpn_codec::array<vrpn_float64>(d_max, 3);
+        }
+
+      private:
+        const char * d_min;
+        const char * d_max;
+    };
+  };
+
+};
+
+#endif // VRPN_TRACKER_CODEC_H
@@ -0,0 +1,112 @@
+#ifndef VRPN_TRACKER_FILTER_H
+#define VRPN_TRACKER_FILTER_H
+
+#include "vrpn_Tracker.h"
+#include "vrpn_OneEuroFilter.h"
+
+#include <quat.h>
+
+// How far ahead vrpn_Tracker_Filter extrapolates the poses it reports.
+enum vrpn_TRACKER_PREDICTION {
+    vrpn_PREDICT_NONE,		// Report the smoothed pose
+    vrpn_PREDICT_VELOCITY,	// Constant linear and angular velocity
+    vrpn_PREDICT_ACCELERATION	// Constant linear acceleration, angular velocity
+};
+
+/// Smooths the poses of one tracker sensor with One Euro filters and
+/// predicts where the sensor will be a given time after its last report.
+/// Velocity and acceleration come from the device's own reports if it sends
+/// them, and otherwise are estimated from the poses, low-pass filtered at the
+/// derivative cutoffs of the One Euro filters.  Rotation is always predicted
+/// at constant angular velocity.
+class VRPN_API vrpn_Tracker_Predictor {
+  public:
+    vrpn_Tracker_Predictor(void);
+
+    /// Sets the One Euro parameters for position and orientation.  A minimum
+    /// cutoff of zero or less turns smoothing off for that part of the pose;
+    /// the derivative cutoff is still used for the velocity estimates.
+    void set_smoothing(vrpn_float64 pos_mincutoff, vrpn_float64 pos_beta,
+                       vrpn_float64 pos_dcutoff, vrpn_float64 quat_mincutoff,
+                       vrpn_float64 quat_beta, vrpn_float64 quat_dcutoff);
+
+    /// Sets how to predict and how far ahead, in seconds.
+    void set_prediction(vrpn_TRACKER_PREDICTION mode, vrpn_float64 horizon);
+
+    /// Forgets all reports.
+    void reset(void);
+
+    /// Takes the next pose report; time is in seconds.
+    void update(vrpn_float64 time, const vrpn_float64 pos[3],
+                const vrpn_float64 quat[4]);
+
+    /// Takes a velocity or acceleration report from the device.  Once one
+    /// has been seen it is used in place of the estimate.
+    void update_velocity(const vrpn_float64 vel[3],
+                         const vrpn_float64 vel_quat[4],
+                         vrpn_float64 vel_quat_dt);
+    void update_acceleration(const vrpn_float64 acc[3]);
+
+    /// Gets the pose predicted for the configured horizon, or for a given
+    /// one, past the last report.  Returns false before the first report.
+    bool predict(vrpn_float64 pos[3], vrpn_float64 quat[4]) const;
+    bool predict(vrpn_float64 horizon, vrpn_float64 pos[3],
+                 vrpn_float64 quat[4]) const;
+
+  protected:
+    vrpn_TRACKER_PREDICTION d_mode;
+    vrpn_float64 d_horizon;
+
+    bool d_smooth_pos, d_smooth_quat;
+    vrpn_float64 d_pos_dcutoff, d_quat_dcutoff;
+    OneEuroFilterVec d_pos_filter;
+    OneEuroFilterQuat d_quat_filter;
+
+    bool d_have_pose;		// Has there been a report yet?
+    vrpn_float64 d_time;	// Time of the last report
+    q_vec_type d_raw_pos;	// Last reported pose, before smoothing
+    q_type d_raw_quat;
+    q_vec_type d_pos;		// Smoothed pose
+    q_type d_quat;
+
+    // Estimates, and whether the device has sent its own.  Angular velocity
+    // is kept as the log of the rotation per second.
+    q_vec_type d_vel, d_acc;
+    q_vec_type d_ang_vel;
+    int d_num_vel;		// Velocity estimates made so far
+    bool d_device_vel, d_device_ang_vel, d_device_acc;
+};
+
+/// A tracker that reports the poses of another tracker after smoothing and
+/// predicting them with a vrpn_Tracker_Predictor per sensor, so that any
+/// tracker can be filtered without changing its driver.  The source name is
+/// opened with a vrpn_Tracker_Remote; if it starts with '*' the server's
+/// own connection is used.  Velocity and acceleration reports from the
+/// source are passed on unchanged.
+class VRPN_API vrpn_Tracker_Filter : public vrpn_Tracker {
+  public:
+    vrpn_Tracker_Filter(const char *name, vrpn_Connection *c,
+                        const char *source, unsigned num_sensors,
+                        vrpn_float64 pos_mincutoff = 1.15,
+                        vrpn_float64 pos_beta = 0.5,
+                        vrpn_float64 pos_dcutoff = 1.2,
+                        vrpn_float64 quat_mincutoff = 1.5,
+                        vrpn_float64 quat_beta = 0.5,
+                        vrpn_float64 quat_dcutoff = 1.2,
+                        vrpn_TRACKER_PREDICTION prediction = vrpn_PREDICT_NONE,
+                        vrpn_float64 horizon = 0);
+    virtual ~vrpn_Tracker_Filter(void);
+
+    virtual void mainloop(void);
+
+  protected:
+    vrpn_Tracker_Remote *d_source;
+    unsigned d_num_predictors;
+    vrpn_Tracker_Predictor *d_predictors;
+
+    static void VRPN_CALLBACK handle_pose(void *userdata, const vrpn_TRACKERCB info);
+    static void VRPN_CALLBACK handle_velocity(void *userdata, const vrpn_TRACKERVELCB info);
+    static void VRPN_CALLBACK handle_acceleration(void *userdata, const vrpn_TRACKERACCCB info);
+};
+
+#endif
@@ -36,6 +36,22 @@ class vrpn_Tracker_GPS: public vrpn_Tracker_Serial {
 
   ~vrpn_Tracker_GPS();
 
+  /// Converts a block of recorded NMEA text, one sentence per line, into
+  /// up to max_positions tracker positions in one call, using the same
+  /// parser state and coordinate settings as the live tracker.  The text
+  /// need not be NUL-terminated; a last line without a newline is left
+  /// for the next call.  If used is not NULL it is set to the number of
+  /// characters consumed.  Returns the number of positions stored; pos is
+  /// left at the last one.
+  int convert_sentences(const char *text, size_t length,
+                        vrpn_float64 (*positions)[3], int max_positions,
+                        size_t *used = NULL);
+
+  /// Converts a block of recorded NMEA text as convert_sentences() does
+  /// and sends a tracker report for each position, all stamped with the
+  /// time of the call.  Returns the number of reports sent.
+  int send_sentences(const char *text, size_t length);
+
 
   /// This function should be called each time through the main loop
   /// of the server code. It polls for a report from the tracker and
@@ -51,6 +67,9 @@ class vrpn_Tracker_GPS: public vrpn_Tracker_Serial {
   virtual int get_report(void);
   virtual void reset();
 
+  /// Stores the fix in data into pos, in UTM or lat/lon/altitude.
+  void position_from_fix(const NMEAData &data);
+
   struct timeval reset_time;
 
   FILE *testfile;
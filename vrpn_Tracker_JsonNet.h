@@ -39,7 +39,35 @@ public:
 		TILT_TRACKER_ID = 0,
 	};
 
-	
+	/**
+	 * The fields of one message, as found by scan_message().  The has_*
+	 * flags tell which of the optional fields the message carried.
+	 */
+	struct Message {
+		int type;
+		int id;
+		bool has_quat;
+		double quat[4];
+		bool has_pos;
+		double pos[3];
+		int button;
+		bool state;
+		int num;
+		double data;
+	};
+
+	/**
+	 * Reads a tracker, button or analog message in a single pass over the
+	 * (NUL-terminated) buffer, without building a JSON tree or touching the
+	 * heap.  Only the flat objects sent by the Android widgets are handled:
+	 * anything else (unknown message types, missing or mistyped fields,
+	 * nested values, escaped strings...) returns false and is left to the
+	 * general JSON reader.
+	 *
+	 * @returns true if msg holds a complete message, false otherwise.
+	 */
+	static bool scan_message(const char* buffer, int length, Message& msg);
+
 private:
 	/*
 	 * Network part
@@ -63,6 +91,8 @@ private:
 	 * Json part
 	 */
 	bool _parse(const char* buffer, int length);
+	bool _apply_message(const Message& msg);
+	bool _parse_json(const char* buffer, int length);
 	bool _parse_tracker_data(const Json::Value& root);
 	bool _parse_analog(const Json::Value& root);
 	bool _parse_button(const Json::Value& root);